@@ -0,0 +1,3 @@
+#pragma once
+// Shim: layer state lives in qmk_stubs
+#include "qmk_stubs.h"
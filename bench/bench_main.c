@@ -0,0 +1,255 @@
+// Host-side benchmark driver: replays keystroke event streams through
+// process_record_user() (dario.c + magic.c + the generated skeletyl keymap)
+// and reports ns/event, cycles/event, and the worst single-event time.
+//
+// Streams:
+//   typing  - press/release over every BASE_NIGHT alpha position, with
+//             tap-settled home-row mods and mixed inter-key intervals
+//   magic   - alternate-repeat triggers (KC_T then the AREP thumb key),
+//             exercising the binary-search lookup, the generated macro
+//             dispatch, and the send-queue drain
+//   combo   - the combo_should_trigger() membership gate across the matrix
+//
+// Numbers are relative (host CPU, -O2), meant for before/after comparison
+// of userspace changes, not absolute MCU timings.
+
+#include "dario.h"
+#include "taphold_stats.h"
+#include "quantum/repeat_key.h"
+
+#include <time.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#    define HAVE_RDTSC 1
+#endif
+
+#define TYPING_ROUNDS 20000
+#define MAGIC_ROUNDS 200000
+#define COMBO_ROUNDS 200000
+
+extern combo_t key_combos[];
+
+typedef struct {
+    uint16_t    keycode;
+    keyrecord_t record;
+    uint8_t     advance_ms;  // simulated time until the next event
+} bench_event_t;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint16_t tap_keycode_of(uint16_t keycode) {
+    if (IS_QK_MOD_TAP(keycode)) return QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    if (IS_QK_LAYER_TAP(keycode)) return QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    return keycode;
+}
+
+// Build press+release pairs over the BASE_NIGHT alpha block. Mod-taps and
+// layer-taps are marked tap-settled (tap.count = 1), matching what QMK hands
+// process_record_user after settlement.
+static size_t build_typing_stream(bench_event_t *events, size_t cap) {
+    // Fast-roll / normal / slow intervals, cycled to exercise both sides of
+    // the flow-tap window
+    static const uint8_t intervals[] = {15, 40, 90, 200};
+    size_t  n   = 0;
+    uint8_t ivl = 0;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS && n + 2 <= cap; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS && n + 2 <= cap; col++) {
+            uint16_t keycode = keycode_at_keymap_location(0 /* BASE_NIGHT */, row, col);
+            if (keycode == KC_NO || keycode == QK_BOOT) {
+                continue;
+            }
+            // Skip the AREP thumb key; the magic stream covers it
+            if (tap_keycode_of(keycode) == QK_AREP) {
+                continue;
+            }
+
+            keyrecord_t record = {0};
+            record.event.key.row = row;
+            record.event.key.col = col;
+            record.tap.count     = (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) ? 1 : 0;
+
+            record.event.pressed   = true;
+            events[n] = (bench_event_t){keycode, record, intervals[ivl++ % ARRAY_SIZE(intervals)]};
+            n++;
+
+            record.event.pressed   = false;
+            events[n] = (bench_event_t){keycode, record, intervals[ivl++ % ARRAY_SIZE(intervals)]};
+            n++;
+        }
+    }
+    return n;
+}
+
+// Mirror QMK core's repeat-key processing order: eligibility then remember,
+// after process_record_user has run for the same press
+static void remember_press(uint16_t keycode, keyrecord_t *record) {
+    uint8_t remembered_mods = 0;
+    if (get_repeat_key_eligible_user(keycode, record, &remembered_mods)) {
+        remember_last_key_user(keycode, record, &remembered_mods);
+    }
+}
+
+static void play_event(bench_event_t *ev) {
+    bench_timer_ms += ev->advance_ms;
+    ev->record.event.time = (uint16_t)bench_timer_ms;
+    process_record_user(ev->keycode, &ev->record);
+    if (ev->record.event.pressed) {
+        remember_press(ev->keycode, &ev->record);
+    }
+    housekeeping_task_user();
+}
+
+typedef struct {
+    uint64_t events;
+    double   ns_per_event;
+    double   cycles_per_event;
+    uint64_t worst_ns;
+} bench_result_t;
+
+static void report(const char *name, bench_result_t r) {
+    printf("%-8s %10llu events  %8.1f ns/event", name, (unsigned long long)r.events, r.ns_per_event);
+#ifdef HAVE_RDTSC
+    printf("  %8.1f cycles/event", r.cycles_per_event);
+#endif
+    printf("  worst %6llu ns\n", (unsigned long long)r.worst_ns);
+}
+
+static bench_result_t run_typing(void) {
+    static bench_event_t stream[2 * MATRIX_ROWS * MATRIX_COLS];
+    size_t len = build_typing_stream(stream, ARRAY_SIZE(stream));
+
+    uint64_t events = (uint64_t)len * TYPING_ROUNDS;
+    uint64_t start_ns = now_ns();
+#ifdef HAVE_RDTSC
+    uint64_t start_cyc = __rdtsc();
+#endif
+    for (uint32_t round = 0; round < TYPING_ROUNDS; round++) {
+        for (size_t i = 0; i < len; i++) {
+            play_event(&stream[i]);
+        }
+    }
+    uint64_t total_ns = now_ns() - start_ns;
+    bench_result_t r = {.events = events, .ns_per_event = (double)total_ns / events};
+#ifdef HAVE_RDTSC
+    r.cycles_per_event = (double)(__rdtsc() - start_cyc) / events;
+#endif
+
+    // Separate instrumented pass for the worst single event (the per-event
+    // clock reads would skew the throughput numbers above)
+    for (size_t i = 0; i < len; i++) {
+        uint64_t t0 = now_ns();
+        play_event(&stream[i]);
+        uint64_t dt = now_ns() - t0;
+        if (dt > r.worst_ns) r.worst_ns = dt;
+    }
+    return r;
+}
+
+static bench_result_t run_magic(void) {
+    // KC_T on BASE_NIGHT maps to a text expansion (MAGIC_NIGHT_T), so each
+    // round covers lookup, generated-macro dispatch, and queue drain
+    keyrecord_t t_rec = {0};
+    t_rec.event.key.row = 1;
+    t_rec.event.key.col = 3;
+
+    uint16_t    arep_kc = LSFT_T(QK_AREP);
+    keyrecord_t arep_rec = {0};
+    arep_rec.event.key.row = 3;
+    arep_rec.event.key.col = 2;
+    arep_rec.tap.count     = 1;
+
+    uint64_t events = MAGIC_ROUNDS;
+    uint64_t start_ns = now_ns();
+#ifdef HAVE_RDTSC
+    uint64_t start_cyc = __rdtsc();
+#endif
+    for (uint32_t round = 0; round < MAGIC_ROUNDS; round++) {
+        bench_timer_ms += 100;
+        t_rec.event.pressed = true;
+        t_rec.event.time    = (uint16_t)bench_timer_ms;
+        process_record_user(KC_T, &t_rec);
+        remember_press(KC_T, &t_rec);
+        t_rec.event.pressed = false;
+        process_record_user(KC_T, &t_rec);
+
+        bench_timer_ms += 100;
+        arep_rec.event.pressed = true;
+        arep_rec.event.time    = (uint16_t)bench_timer_ms;
+        process_record_user(arep_kc, &arep_rec);
+        arep_rec.event.pressed = false;
+        process_record_user(arep_kc, &arep_rec);
+
+        // Drain the queued expansion one char per scan
+        for (uint8_t scan = 0; scan < 4; scan++) {
+            bench_timer_ms += 1;
+            housekeeping_task_user();
+        }
+    }
+    uint64_t total_ns = now_ns() - start_ns;
+    bench_result_t r = {.events = events, .ns_per_event = (double)total_ns / events};
+#ifdef HAVE_RDTSC
+    r.cycles_per_event = (double)(__rdtsc() - start_cyc) / events;
+#endif
+
+    uint64_t t0 = now_ns();
+    arep_rec.event.pressed = true;
+    process_record_user(arep_kc, &arep_rec);
+    arep_rec.event.pressed = false;
+    process_record_user(arep_kc, &arep_rec);
+    r.worst_ns = now_ns() - t0;
+    return r;
+}
+
+static bench_result_t run_combo_gate(void) {
+    keyrecord_t record = {0};
+    record.event.pressed = true;
+
+    uint64_t events = 0;
+    volatile uint32_t sink = 0;
+    uint64_t start_ns = now_ns();
+#ifdef HAVE_RDTSC
+    uint64_t start_cyc = __rdtsc();
+#endif
+    for (uint32_t round = 0; round < COMBO_ROUNDS / (MATRIX_ROWS * MATRIX_COLS); round++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                record.event.key.row = row;
+                record.event.key.col = col;
+                uint16_t keycode = keycode_at_keymap_location(0, row, col);
+                sink += combo_should_trigger(0, &key_combos[0], keycode, &record);
+                events++;
+            }
+        }
+    }
+    uint64_t total_ns = now_ns() - start_ns;
+    bench_result_t r = {.events = events, .ns_per_event = (double)total_ns / events};
+#ifdef HAVE_RDTSC
+    r.cycles_per_event = (double)(__rdtsc() - start_cyc) / events;
+#endif
+
+    uint64_t t0 = now_ns();
+    combo_should_trigger(0, &key_combos[0], KC_B, &record);
+    r.worst_ns = now_ns() - t0;
+    (void)sink;
+    return r;
+}
+
+int main(void) {
+    printf("userspace bench (skeletyl keymap, host build)\n");
+    printf("---------------------------------------------\n");
+
+    report("typing", run_typing());
+    report("magic", run_magic());
+    report("combo", run_combo_gate());
+
+    printf("---------------------------------------------\n");
+    printf("taps sent: %u, chars queued+sent: %u\n", bench_taps_sent, bench_chars_sent);
+    return 0;
+}
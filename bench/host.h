@@ -0,0 +1,21 @@
+// Shim for tmk_core host.h: just enough driver surface for report_batch.c.
+// The stub driver counts keyboard reports so the bench can assert on how
+// many actually reach the "host".
+#pragma once
+
+#include <stdint.h>
+#include "report.h"
+
+typedef struct {
+    uint8_t (*keyboard_leds)(void);
+    void (*send_keyboard)(report_keyboard_t *);
+    void (*send_nkro)(report_keyboard_t *);
+    void (*send_mouse)(void *);
+    void (*send_extra)(void *);
+} host_driver_t;
+
+host_driver_t *host_get_driver(void);
+void           host_set_driver(host_driver_t *driver);
+
+// Bench controls (implemented in qmk_stubs.c)
+extern uint32_t bench_reports_sent;
@@ -0,0 +1,3 @@
+#pragma once
+// Shim: console output goes through the uprintf stub
+#include "qmk_stubs.h"
@@ -0,0 +1,126 @@
+// Host-side implementations of the QMK runtime surface the userspace code
+// touches. Everything is deliberately cheap so measurements reflect our own
+// code, not the stubs.
+
+#include "qmk_stubs.h"
+
+layer_state_t layer_state         = 0;
+layer_state_t default_layer_state = 1;
+
+uint32_t bench_timer_ms  = 0;
+uint32_t bench_taps_sent = 0;
+uint32_t bench_chars_sent = 0;
+
+static uint8_t current_mods = 0;
+
+uint8_t get_highest_layer(layer_state_t state) {
+    uint8_t layer = 0;
+    while (state >>= 1) {
+        layer++;
+    }
+    return layer;
+}
+
+void default_layer_set(layer_state_t state) {
+    default_layer_state = state;
+}
+
+// Host driver with a report counter, so report_batch.c's coalescing is
+// observable from the bench
+#include "host.h"
+
+uint32_t bench_reports_sent = 0;
+
+static void stub_send_keyboard(report_keyboard_t *report) {
+    (void)report;
+    bench_reports_sent++;
+}
+
+static host_driver_t stub_driver = {
+    .send_keyboard = stub_send_keyboard,
+};
+static host_driver_t *active_driver = &stub_driver;
+
+host_driver_t *host_get_driver(void) {
+    return active_driver;
+}
+
+void host_set_driver(host_driver_t *driver) {
+    active_driver = driver;
+}
+
+static uint8_t fake_eeprom[EECONFIG_USER_DATA_SIZE] = {
+    [0 ... EECONFIG_USER_DATA_SIZE - 1] = 0xFF  // erased, like real EEPROM
+};
+
+void eeconfig_read_user_datablock(void *data) {
+    memcpy(data, fake_eeprom, sizeof(fake_eeprom));
+}
+
+void eeconfig_update_user_datablock(const void *data) {
+    memcpy(fake_eeprom, data, sizeof(fake_eeprom));
+}
+
+extern const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS];
+
+char chordal_hold_handedness(keypos_t key) {
+    return (char)pgm_read_byte(&chordal_hold_layout[key.row][key.col]);
+}
+
+uint8_t get_mods(void) {
+    return current_mods;
+}
+
+void bench_set_mods(uint8_t mods) {
+    current_mods = mods;
+}
+
+void tap_code16(uint16_t keycode) {
+    (void)keycode;
+    bench_taps_sent++;
+}
+
+void send_char(char c) {
+    (void)c;
+    bench_chars_sent++;
+}
+
+uint16_t timer_read(void) {
+    return (uint16_t)bench_timer_ms;
+}
+
+uint32_t timer_read32(void) {
+    return bench_timer_ms;
+}
+
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(timer_read() - last);
+}
+
+uint32_t timer_elapsed32(uint32_t last) {
+    return timer_read32() - last;
+}
+
+int uprintf(const char *fmt, ...) {
+    (void)fmt;
+    return 0;
+}
+
+// Split transaction shims (transactions.h)
+bool is_keyboard_master(void) {
+    return true;
+}
+
+void transaction_register_rpc(int8_t transaction_id,
+                              void (*callback)(uint8_t, const void *, uint8_t, void *)) {
+    (void)transaction_id;
+    (void)callback;
+}
+
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buffer_size,
+                          const void *initiator2target_buffer) {
+    (void)transaction_id;
+    (void)initiator2target_buffer_size;
+    (void)initiator2target_buffer;
+    return true;
+}
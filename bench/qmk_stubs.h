@@ -0,0 +1,230 @@
+#pragma once
+
+// Minimal host-side stand-in for QMK_KEYBOARD_H, covering exactly the API
+// surface that qmk/users/dario/*.c and the generated skeletyl keymap.c
+// consume. Keycode encodings (HID values, mod-tap/layer-tap bit layout,
+// QK_REP/QK_AREP) match upstream QMK so the generated tables and the
+// binary-search/range-check logic behave identically to on-device builds.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+// Matrix / layout (skeletyl: split, 4 rows x 5 cols per half)
+// ---------------------------------------------------------------------------
+
+#define MATRIX_ROWS 8
+#define MATRIX_COLS 5
+
+// Generated keymap argument order: left row, right row (x3), then thumbs.
+// Right-half columns are mirrored like the real board's electrical matrix.
+#define LAYOUT_split_3x5_3( \
+    L00, L01, L02, L03, L04, \
+    R00, R01, R02, R03, R04, \
+    L10, L11, L12, L13, L14, \
+    R10, R11, R12, R13, R14, \
+    L20, L21, L22, L23, L24, \
+    R20, R21, R22, R23, R24, \
+    LT0, LT1, LT2, \
+    RT0, RT1, RT2) \
+    { \
+        { L00, L01, L02, L03, L04 }, \
+        { L10, L11, L12, L13, L14 }, \
+        { L20, L21, L22, L23, L24 }, \
+        { LT0, LT1, LT2, 0, 0 }, \
+        { R04, R03, R02, R01, R00 }, \
+        { R14, R13, R12, R11, R10 }, \
+        { R24, R23, R22, R21, R20 }, \
+        { RT2, RT1, RT0, 0, 0 }, \
+    }
+
+// ---------------------------------------------------------------------------
+// Core types
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef struct {
+    keypos_t key;
+    uint16_t time;
+    bool     pressed;
+} keyevent_t;
+
+typedef struct {
+    struct {
+        uint8_t count;
+        bool    interrupted;
+    } tap;
+    keyevent_t event;
+} keyrecord_t;
+
+typedef uint32_t layer_state_t;
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+uint8_t get_highest_layer(layer_state_t state);
+void    default_layer_set(layer_state_t state);
+
+// Eeconfig user datablock (base_layer_persist.c) backed by a RAM array
+// that starts out erased (0xFF) like real EEPROM
+void eeconfig_read_user_datablock(void *data);
+void eeconfig_update_user_datablock(const void *data);
+
+// Chordal hold handedness, reading the generated chordal_hold_layout table
+// (defined in the keymap translation unit) like QMK core does
+char chordal_hold_handedness(keypos_t key);
+
+// ---------------------------------------------------------------------------
+// PROGMEM (flat memory on the host)
+// ---------------------------------------------------------------------------
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
+// ---------------------------------------------------------------------------
+// Basic keycodes (HID usage values, as in QMK)
+// ---------------------------------------------------------------------------
+
+enum {
+    KC_NO = 0x00,
+    KC_TRNS = 0x01,
+    KC_A = 0x04, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J,
+    KC_K, KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T,
+    KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z,
+    KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0,
+    KC_ENT, KC_ESC, KC_BSPC, KC_TAB, KC_SPC,
+    KC_MINS, KC_EQL, KC_LBRC, KC_RBRC, KC_BSLS, KC_NUHS,
+    KC_SCLN, KC_QUOT, KC_GRV, KC_COMM, KC_DOT, KC_SLSH, KC_CAPS,
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6,
+    KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12,
+    KC_PSCR, KC_SCRL, KC_PAUS, KC_INS, KC_HOME, KC_PGUP,
+    KC_DEL, KC_END, KC_PGDN, KC_RGHT, KC_LEFT, KC_DOWN, KC_UP,
+    KC_APP = 0x65,
+    KC_MUTE = 0xA8, KC_VOLU, KC_VOLD, KC_MNXT, KC_MPRV, KC_MSTP, KC_MPLY,
+    KC_LCTL = 0xE0, KC_LSFT, KC_LALT, KC_LGUI,
+    KC_RCTL, KC_RSFT, KC_RALT, KC_RGUI,
+};
+
+// ---------------------------------------------------------------------------
+// Quantum keycode ranges (bit layout matches QMK)
+// ---------------------------------------------------------------------------
+
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+
+#define LCTL(kc) (QK_LCTL | (kc))
+#define LSFT(kc) (QK_LSFT | (kc))
+#define LALT(kc) (QK_LALT | (kc))
+#define LGUI(kc) (QK_LGUI | (kc))
+#define SGUI(kc) (QK_LGUI | QK_LSFT | (kc))
+
+// Shifted punctuation aliases
+#define KC_TILD LSFT(KC_GRV)
+#define KC_EXLM LSFT(KC_1)
+#define KC_AT   LSFT(KC_2)
+#define KC_HASH LSFT(KC_3)
+#define KC_DLR  LSFT(KC_4)
+#define KC_PERC LSFT(KC_5)
+#define KC_CIRC LSFT(KC_6)
+#define KC_AMPR LSFT(KC_7)
+#define KC_ASTR LSFT(KC_8)
+#define KC_LPRN LSFT(KC_9)
+#define KC_RPRN LSFT(KC_0)
+#define KC_UNDS LSFT(KC_MINS)
+#define KC_PLUS LSFT(KC_EQL)
+#define KC_LCBR LSFT(KC_LBRC)
+#define KC_RCBR LSFT(KC_RBRC)
+#define KC_PIPE LSFT(KC_BSLS)
+#define KC_COLN LSFT(KC_SCLN)
+#define KC_DQUO LSFT(KC_QUOT)
+#define KC_LT   LSFT(KC_COMM)
+#define KC_GT   LSFT(KC_DOT)
+#define KC_QUES LSFT(KC_SLSH)
+
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+#define MOD_MASK_CTRL  (MOD_LCTL | 0x10)
+#define MOD_MASK_SHIFT (MOD_LSFT | 0x20)
+#define MOD_MASK_ALT   (MOD_LALT | 0x40)
+#define MOD_MASK_GUI   (MOD_LGUI | 0x80)
+
+#define QK_MOD_TAP     0x2000
+#define QK_MOD_TAP_MAX 0x3FFF
+#define MT(mod, kc) (QK_MOD_TAP | (((mod) & 0x1F) << 8) | ((kc) & 0xFF))
+#define LCTL_T(kc) MT(MOD_LCTL, kc)
+#define LSFT_T(kc) MT(MOD_LSFT, kc)
+#define LALT_T(kc) MT(MOD_LALT, kc)
+#define LGUI_T(kc) MT(MOD_LGUI, kc)
+
+#define QK_LAYER_TAP     0x4000
+#define QK_LAYER_TAP_MAX 0x4FFF
+#define LT(layer, kc) (QK_LAYER_TAP | (((layer) & 0xF) << 8) | ((kc) & 0xFF))
+
+#define IS_QK_MOD_TAP(kc)   ((kc) >= QK_MOD_TAP && (kc) <= QK_MOD_TAP_MAX)
+#define IS_QK_LAYER_TAP(kc) ((kc) >= QK_LAYER_TAP && (kc) <= QK_LAYER_TAP_MAX)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc)   ((uint16_t)((kc) & 0xFF))
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((uint16_t)((kc) & 0xFF))
+
+#define QK_DEF_LAYER 0x5240
+#define DF(layer) (QK_DEF_LAYER | (layer))
+
+#define QK_BOOT 0x7C00
+#define QK_REP  0x7C79
+#define QK_AREP 0x7C7A
+#define SAFE_RANGE 0x7E40
+
+// ---------------------------------------------------------------------------
+// Combos (just enough for the generated combo tables to compile)
+// ---------------------------------------------------------------------------
+
+#define COMBO_END 0
+
+typedef struct {
+    const uint16_t *keys;
+    uint16_t        keycode;
+} combo_t;
+
+#define COMBO(ck, ca) { .keys = (ck), .keycode = (ca) }
+
+bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record);
+void process_combo_event(uint16_t combo_index, bool pressed);
+
+// ---------------------------------------------------------------------------
+// Runtime shims (implemented in qmk_stubs.c; bench_* hooks drive/observe them)
+// ---------------------------------------------------------------------------
+
+uint8_t get_mods(void);
+void    tap_code16(uint16_t keycode);
+void    send_char(char c);
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+
+int uprintf(const char *fmt, ...);
+
+// Weak-symbol chain entry points normally called by QMK core
+bool process_record_user(uint16_t keycode, keyrecord_t *record);
+void housekeeping_task_user(void);
+uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t col);
+
+// Bench controls over the stub state
+extern uint32_t bench_timer_ms;
+extern uint32_t bench_taps_sent;
+extern uint32_t bench_chars_sent;
+void bench_set_mods(uint8_t mods);
@@ -0,0 +1,3 @@
+#pragma once
+// Shim: keycode ranges are defined in qmk_stubs.h
+#include "qmk_stubs.h"
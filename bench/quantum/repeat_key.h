@@ -0,0 +1,7 @@
+#pragma once
+// Shim: repeat-key hook signatures; last-key state itself lives in magic.c
+#include "qmk_stubs.h"
+
+uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods);
+bool get_repeat_key_eligible_user(uint16_t keycode, keyrecord_t *record, uint8_t *remembered_mods);
+bool remember_last_key_user(uint16_t keycode, keyrecord_t *record, uint8_t *remembered_mods);
@@ -0,0 +1,13 @@
+// Shim for tmk_core report.h: the 6KRO keyboard report layout, which is all
+// report_batch.c needs (its byte-wise logic is format-agnostic).
+#pragma once
+
+#include <stdint.h>
+
+#define KEYBOARD_REPORT_KEYS 6
+
+typedef struct {
+    uint8_t mods;
+    uint8_t reserved;
+    uint8_t keys[KEYBOARD_REPORT_KEYS];
+} report_keyboard_t;
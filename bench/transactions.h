@@ -0,0 +1,13 @@
+#pragma once
+// Shim: split transaction API (no transport on the host)
+#include "qmk_stubs.h"
+
+enum bench_transaction_ids {
+    RPC_ID_USER_BASE_LAYER = 0,
+};
+
+bool is_keyboard_master(void);
+void transaction_register_rpc(int8_t transaction_id,
+                              void (*callback)(uint8_t, const void *, uint8_t, void *));
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buffer_size,
+                          const void *initiator2target_buffer);
@@ -52,13 +52,17 @@ else
 fi
 echo "Using Python interpreter: $PYTHON_BIN"
 
-# Clean and create output directory
+# Prepare the output directory. Existing artifacts are preserved so that
+# unchanged firmware keeps its content hash across runs (the manifest diff
+# and flash_boaty.sh rely on this); builders simply overwrite what changed.
+# Only stale build logs are cleared.
 echo -e "${BLUE}Preparing output directory...${NC}"
-rm -rf "$OUTPUT_DIR"
 mkdir -p "$OUTPUT_DIR/qmk"
 mkdir -p "$OUTPUT_DIR/zmk"
 mkdir -p "$OUTPUT_DIR/visualizations"
 mkdir -p "$OUTPUT_DIR/keylayout"
+rm -f "$OUTPUT_DIR/zmk_build.log"
+rm -rf "$OUTPUT_DIR/qmk/logs"
 echo -e "${GREEN}✓ Output directory ready: $OUTPUT_DIR${NC}"
 echo ""
 
@@ -84,24 +88,13 @@ else
     exit 1
 fi
 
-# Build QMK firmware
+# Build QMK and ZMK firmware concurrently: the ZMK build spends most of its
+# time on container spin-up / west setup, so it overlaps the QMK compiles
+# instead of adding to them. ZMK output goes to a log to keep the
+# interleaved phases readable.
 echo ""
 echo "================================================"
-echo "Phase 1: QMK Firmware"
-echo "================================================"
-echo ""
-
-if bash "$REPO_ROOT/qmk/build_qmk.sh"; then
-    QMK_SUCCESS=true
-else
-    echo -e "${YELLOW}⚠ QMK builds failed${NC}"
-    echo ""
-fi
-
-# Build ZMK firmware
-echo ""
-echo "================================================"
-echo "Phase 2: ZMK Firmware"
+echo "Phase 1: QMK + ZMK Firmware (parallel)"
 echo "================================================"
 echo ""
 
@@ -112,20 +105,55 @@ else
     ZMK_BUILD_SCRIPT="$REPO_ROOT/zmk/build_zmk.sh"
 fi
 
+ZMK_PID=""
+ZMK_LOG="$OUTPUT_DIR/zmk_build.log"
 if [ -f "$ZMK_BUILD_SCRIPT" ]; then
     ZMK_ARGS=()
     if [ "$VERBOSE" -eq 1 ]; then
         ZMK_ARGS+=("-v")
     fi
-    if bash "$ZMK_BUILD_SCRIPT" "${ZMK_ARGS[@]}"; then
+    echo -e "${BLUE}Starting ZMK build in background (log: $ZMK_LOG)...${NC}"
+    bash "$ZMK_BUILD_SCRIPT" "${ZMK_ARGS[@]}" >"$ZMK_LOG" 2>&1 &
+    ZMK_PID=$!
+else
+    echo -e "${YELLOW}ZMK build script not found, skipping ZMK builds${NC}"
+    echo ""
+fi
+
+if bash "$REPO_ROOT/qmk/build_qmk.sh"; then
+    QMK_SUCCESS=true
+else
+    echo -e "${YELLOW}⚠ QMK builds failed${NC}"
+    echo ""
+fi
+
+if [ -n "$ZMK_PID" ]; then
+    echo ""
+    echo -e "${BLUE}Waiting for ZMK build...${NC}"
+    if wait "$ZMK_PID"; then
         ZMK_SUCCESS=true
+        echo -e "${GREEN}✓ ZMK builds successful${NC}"
     else
         echo -e "${YELLOW}⚠ ZMK builds failed${NC}"
+        echo "--- last 30 lines of $ZMK_LOG ---"
+        tail -n 30 "$ZMK_LOG"
+        echo "---"
         echo ""
     fi
+fi
+
+# Write the firmware artifact manifest (content hash + size per image,
+# plus the config digest the images were built from) and show which
+# artifacts actually changed this run
+echo ""
+echo "================================================"
+echo "Phase 2: Artifact Manifest"
+echo "================================================"
+echo ""
+if "$PYTHON_BIN" "$REPO_ROOT/scripts/artifact_manifest.py"; then
+    :
 else
-    echo -e "${YELLOW}ZMK build script not found, skipping ZMK builds${NC}"
-    echo ""
+    echo -e "${YELLOW}⚠ Manifest generation failed${NC}"
 fi
 
 # Summary
@@ -2,11 +2,23 @@
 # Flash script for Jels Boaty keyboard
 # Processor: atmega328p
 # Bootloader: usbasploader
+#
+# Skips the flash when the firmware content hash matches the last image
+# flashed by this script (recorded in out/.boaty_last_flashed), so a
+# docs-only or other-board rebuild doesn't require bootloader mode.
+# Use --force to flash regardless.
 
 set -e
 
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
-FIRMWARE_FILE="$SCRIPT_DIR/out/qmk/jels_boaty_dario.hex"
+FIRMWARE_NAME="qmk/jels_boaty_dario.hex"
+FIRMWARE_FILE="$SCRIPT_DIR/out/$FIRMWARE_NAME"
+LAST_FLASHED_FILE="$SCRIPT_DIR/out/.boaty_last_flashed"
+
+FORCE=0
+if [ "$1" = "-f" ] || [ "$1" = "--force" ]; then
+    FORCE=1
+fi
 
 # Colors for output
 GREEN='\033[0;32m'
@@ -25,8 +37,26 @@ if [ ! -f "$FIRMWARE_FILE" ]; then
 fi
 
 echo -e "${GREEN}✓${NC} Found firmware: $FIRMWARE_FILE"
+
+# Content hash of the image about to be flashed (prefers the manifest
+# written by build_all.sh, falls back to hashing the file directly)
+FIRMWARE_HASH="$(python3 "$SCRIPT_DIR/scripts/artifact_manifest.py" --hash "$FIRMWARE_NAME")"
+echo "  sha256: $FIRMWARE_HASH"
 echo ""
 
+# Skip no-op flashes: identical content means the board is already
+# running this image
+if [ -f "$LAST_FLASHED_FILE" ] && [ "$(cat "$LAST_FLASHED_FILE")" = "$FIRMWARE_HASH" ]; then
+    if [ "$FORCE" -eq 1 ]; then
+        echo -e "${YELLOW}Firmware unchanged since last flash — flashing anyway (--force)${NC}"
+        echo ""
+    else
+        echo -e "${GREEN}✓ Firmware unchanged since last flash — nothing to do${NC}"
+        echo "Use --force to flash anyway."
+        exit 0
+    fi
+fi
+
 # Show instructions
 echo -e "${YELLOW}Hold BOOT button while plugging in USB, then press ENTER${NC}"
 read -p ""
@@ -38,6 +68,9 @@ echo ""
 # Use QMK's flash command
 qmk flash -m atmega328p "$FIRMWARE_FILE"
 
+# Record the hash only after a successful flash
+echo "$FIRMWARE_HASH" > "$LAST_FLASHED_FILE"
+
 echo ""
 echo -e "${GREEN}✓ Flash complete!${NC}"
 echo "Your Boaty keyboard should now be running the new firmware."
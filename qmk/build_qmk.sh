@@ -75,13 +75,75 @@ NC='\033[0m' # No Color
 
 # Ensure output directory exists
 mkdir -p "$OUTPUT_DIR"
+LOG_DIR="$OUTPUT_DIR/logs"
+mkdir -p "$LOG_DIR"
 
-# Build all keyboards defined in qmk.json
-echo -e "${BLUE}Building keyboards from qmk.json...${NC}"
-echo "Command: qmk userspace-compile"
+# Wire ccache into the toolchain via PATH masquerading when available, so
+# unchanged translation units across boards hit the shared compile cache
+if command -v ccache >/dev/null 2>&1; then
+    for CCACHE_DIR_CANDIDATE in /usr/lib/ccache /usr/lib64/ccache "$(brew --prefix 2>/dev/null)/opt/ccache/libexec"; do
+        if [ -d "$CCACHE_DIR_CANDIDATE" ]; then
+            export PATH="$CCACHE_DIR_CANDIDATE:$PATH"
+            echo "ccache enabled via $CCACHE_DIR_CANDIDATE"
+            break
+        fi
+    done
+fi
+
+# Parallelism: targets build concurrently, each with a share of the cores
+CORES="$(nproc 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 4)"
+
+# Read build targets from qmk.json (same source qmk userspace-compile uses)
+TARGETS=()
+while IFS= read -r line; do
+    TARGETS+=("$line")
+done < <(python3 -c "
+import json
+with open('$SCRIPT_DIR/qmk.json') as f:
+    for kb, km in json.load(f)['build_targets']:
+        print(f'{kb}:{km}')
+")
+
+NTARGETS="${#TARGETS[@]}"
+if [ "$NTARGETS" -eq 0 ]; then
+    echo -e "${YELLOW}✗ No build targets in qmk.json${NC}"
+    exit 1
+fi
+MAKE_JOBS=$(( CORES / NTARGETS ))
+[ "$MAKE_JOBS" -lt 1 ] && MAKE_JOBS=1
+
+echo -e "${BLUE}Building $NTARGETS keyboards from qmk.json in parallel (${CORES} cores, -j${MAKE_JOBS} each)...${NC}"
 echo ""
 
-if qmk userspace-compile; then
+# Launch all targets concurrently; each gets its own log so interleaved
+# output stays readable, and failures print their log tail afterwards
+PIDS=()
+LOGS=()
+for target in "${TARGETS[@]}"; do
+    kb="${target%%:*}"
+    km="${target##*:}"
+    log="$LOG_DIR/$(echo "$kb" | tr '/' '_').log"
+    qmk compile -kb "$kb" -km "$km" -j "$MAKE_JOBS" >"$log" 2>&1 &
+    PIDS+=($!)
+    LOGS+=("$log")
+    echo "  ⏳ $kb ($log)"
+done
+
+BUILD_FAILED=0
+for i in "${!PIDS[@]}"; do
+    target="${TARGETS[$i]}"
+    if wait "${PIDS[$i]}"; then
+        echo -e "  ${GREEN}✓ ${target%%:*}${NC}"
+    else
+        echo -e "  ${YELLOW}✗ ${target%%:*}${NC}"
+        echo "--- last 20 lines of ${LOGS[$i]} ---"
+        tail -n 20 "${LOGS[$i]}"
+        echo "---"
+        BUILD_FAILED=1
+    fi
+done
+
+if [ "$BUILD_FAILED" -eq 0 ]; then
     echo ""
     echo -e "${GREEN}✓ QMK builds successful${NC}"
     echo ""
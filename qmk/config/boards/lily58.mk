@@ -7,8 +7,12 @@ SPLIT_KEYBOARD = yes
 # Lily58-specific features
 MOUSEKEY_ENABLE = yes          # Mouse keys
 OLED_ENABLE = yes              # OLED display
-WPM_ENABLE = yes               # Words per minute tracking for OLED
+WPM_ENABLE = no                # Stock WPM replaced by users/dario/wpm_lite.c
+OPT_DEFS += -DWPM_LITE_ENABLE  # Fixed-point 1Hz WPM estimator for the OLED
 
 # Optional features
 ENCODER_ENABLE = no            # Rotary encoders (if present)
 RGB_MATRIX_ENABLE = no         # RGB lighting (not used on Lily58)
+
+# Defer OLED bring-up past the first scan cycles after a replug
+OPT_DEFS += -DLAZY_PERIPHERAL_INIT
@@ -13,3 +13,12 @@ override CONSOLE_ENABLE = yes  # Safe on RP2040; used for combo logging
 # Optional features
 ENCODER_ENABLE = no            # Rotary encoders (if present)
 WPM_ENABLE = no                # Words per minute tracking
+
+# Defer OLED/RGB bring-up past the first scan cycles after a replug
+OPT_DEFS += -DLAZY_PERIPHERAL_INIT
+
+# --- BEGIN GENERATED: idle sleep (sleep_timeout_s in config/boards.yaml) ---
+# Do not edit by hand; regenerate with scripts/generate.py
+OPT_DEFS += -DIDLE_SLEEP_ENABLE
+OPT_DEFS += -DIDLE_SLEEP_TIMEOUT_MS=600000UL
+# --- END GENERATED: idle sleep ---
@@ -5,14 +5,9 @@
 
 #include "dario.h"
 
-#ifndef MACRO_GITHUB_URL
-#define MACRO_GITHUB_URL SAFE_RANGE
-#endif
-
+// Continues after the shared custom keycodes in dario.h
 enum magic_macros {
-    MAGIC_DUSK_CHR_32 = MACRO_GITHUB_URL + 1,
-    MAGIC_DUSK_CHR_44,
-    MAGIC_NIGHT_B,
+    MAGIC_NIGHT_B = CUSTOM_KEYCODES_END,
     MAGIC_NIGHT_CHR_32,
     MAGIC_NIGHT_CHR_44,
     MAGIC_NIGHT_I,
@@ -22,104 +17,283 @@ enum magic_macros {
     MAGIC_NIGHT_Q,
     MAGIC_NIGHT_T,
     MAGIC_NIGHT_W,
-    MAGIC_RACKET_CHR_32,
-    MAGIC_RACKET_CHR_44,
 };
 
 
-const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+// Dictionary-compressed keymap storage (compress_keymap: true in boards.yaml)
+// 133 unique keycodes across 9 layers; each position stores an
+// 8-bit dictionary index, decoded by keycode_at_keymap_location() below.
+// Pruned (not in this board's base_layers allowlist): BASE_DUSK, BASE_RACKET; their slots decode to KC_NO.
+static const uint16_t PROGMEM keymap_dict[133] = {
+    KC_NO,  // 0
+    KC_B,  // 1
+    KC_F,  // 2
+    KC_L,  // 3
+    KC_K,  // 4
+    KC_Q,  // 5
+    KC_P,  // 6
+    KC_G,  // 7
+    KC_O,  // 8
+    KC_U,  // 9
+    KC_DOT,  // 10
+    LGUI_T(KC_N),  // 11
+    LALT_T(KC_S),  // 12
+    LCTL_T(KC_H),  // 13
+    LSFT_T(KC_T),  // 14
+    KC_M,  // 15
+    KC_Y,  // 16
+    LSFT_T(KC_C),  // 17
+    LCTL_T(KC_A),  // 18
+    LALT_T(KC_E),  // 19
+    LGUI_T(KC_I),  // 20
+    KC_X,  // 21
+    KC_V,  // 22
+    KC_J,  // 23
+    KC_D,  // 24
+    KC_Z,  // 25
+    KC_QUOT,  // 26
+    KC_W,  // 27
+    KC_MINS,  // 28
+    KC_SCLN,  // 29
+    KC_COMM,  // 30
+    LT(NUM_NIGHT, KC_BSPC),  // 31
+    LT(SYM_NIGHT, KC_R),  // 32
+    LSFT_T(QK_AREP),  // 33
+    LSFT_T(KC_TAB),  // 34
+    LT(NAV_NIGHT, KC_SPC),  // 35
+    LT(MEDIA_NIGHT, KC_ENT),  // 36
+    KC_C,  // 37
+    LALT_T(KC_R),  // 38
+    LCTL_T(KC_T),  // 39
+    LSFT_T(KC_S),  // 40
+    LSFT_T(KC_H),  // 41
+    LT(SYM_NIGHT, QK_AREP),  // 42
+    LSFT_T(KC_DEL),  // 43
+    KC_F12,  // 44
+    KC_F7,  // 45
+    KC_F8,  // 46
+    KC_F9,  // 47
+    KC_PSCR,  // 48
+    KC_F11,  // 49
+    KC_F4,  // 50
+    KC_F5,  // 51
+    KC_F6,  // 52
+    KC_SCRL,  // 53
+    KC_LSFT,  // 54
+    KC_LCTL,  // 55
+    KC_LALT,  // 56
+    KC_LGUI,  // 57
+    KC_F10,  // 58
+    KC_F1,  // 59
+    KC_F2,  // 60
+    KC_F3,  // 61
+    KC_PAUS,  // 62
+    KC_APP,  // 63
+    KC_SPC,  // 64
+    KC_TAB,  // 65
+    KC_TILD,  // 66
+    KC_PERC,  // 67
+    KC_COLN,  // 68
+    KC_CIRC,  // 69
+    KC_7,  // 70
+    KC_8,  // 71
+    KC_9,  // 72
+    KC_PIPE,  // 73
+    KC_HASH,  // 74
+    KC_1,  // 75
+    KC_2,  // 76
+    KC_3,  // 77
+    KC_GRV,  // 78
+    LGUI(KC_Z),  // 79
+    LGUI(KC_X),  // 80
+    LGUI(KC_C),  // 81
+    LGUI(KC_V),  // 82
+    SGUI(KC_Z),  // 83
+    KC_DLR,  // 84
+    KC_4,  // 85
+    KC_5,  // 86
+    KC_6,  // 87
+    KC_SLSH,  // 88
+    KC_0,  // 89
+    KC_AT,  // 90
+    KC_ASTR,  // 91
+    KC_PLUS,  // 92
+    KC_LCBR,  // 93
+    KC_RCBR,  // 94
+    KC_EQL,  // 95
+    KC_EXLM,  // 96
+    KC_QUES,  // 97
+    KC_LPRN,  // 98
+    KC_RPRN,  // 99
+    KC_AMPR,  // 100
+    KC_BSLS,  // 101
+    KC_LT,  // 102
+    KC_LBRC,  // 103
+    KC_RBRC,  // 104
+    KC_GT,  // 105
+    KC_ENT,  // 106
+    KC_PGUP,  // 107
+    KC_ESC,  // 108
+    KC_LEFT,  // 109
+    KC_UP,  // 110
+    KC_RGHT,  // 111
+    KC_CAPS,  // 112
+    KC_END,  // 113
+    KC_PGDN,  // 114
+    KC_DOWN,  // 115
+    KC_HOME,  // 116
+    KC_INS,  // 117
+    KC_BSPC,  // 118
+    KC_DEL,  // 119
+    DF(BASE_NIGHT),  // 120
+    DF(BASE_GALLIUM),  // 121
+    KC_MNXT,  // 122
+    KC_VOLU,  // 123
+    KC_VOLD,  // 124
+    KC_MPRV,  // 125
+    THSTAT_DUMP,  // 126
+    PERF_TOGG,  // 127
+    TRACE_TOGG,  // 128
+    QK_BOOT,  // 129
+    KC_MUTE,  // 130
+    KC_MPLY,  // 131
+    KC_MSTP,  // 132
+};
+
+static const uint8_t PROGMEM keymap_indices[9][MATRIX_ROWS][MATRIX_COLS] = {
     [BASE_NIGHT] = LAYOUT_split_3x5_3(
-        KC_B                , KC_F                , KC_L                , KC_K                , KC_Q                ,
-        KC_P                , KC_G                , KC_O                , KC_U                , KC_DOT              ,
-        LGUI_T(KC_N)        , LALT_T(KC_S)        , LCTL_T(KC_H)        , LSFT_T(KC_T)        , KC_M                ,
-        KC_Y                , LSFT_T(KC_C)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        ,
-        KC_X                , KC_V                , KC_J                , KC_D                , KC_Z                ,
-        KC_QUOT             , KC_W                , KC_MINS             , KC_SCLN             , KC_COMM             ,
-                              LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, KC_R) , LSFT_T(QK_AREP)     ,
-                              LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
+        1                   , 2                   , 3                   , 4                   , 5                   ,
+        6                   , 7                   , 8                   , 9                   , 10                  ,
+        11                  , 12                  , 13                  , 14                  , 15                  ,
+        16                  , 17                  , 18                  , 19                  , 20                  ,
+        21                  , 22                  , 23                  , 24                  , 25                  ,
+        26                  , 27                  , 28                  , 29                  , 30                  ,
+                              31                  , 32                  , 33                  ,
+                              34                  , 35                  , 36                  
     ),
     [BASE_GALLIUM] = LAYOUT_split_3x5_3(
-        KC_B                , KC_L                , KC_D                , KC_C                , KC_V                ,
-        KC_J                , KC_Y                , KC_O                , KC_U                , KC_DOT              ,
-        LGUI_T(KC_N)        , LALT_T(KC_R)        , LCTL_T(KC_T)        , LSFT_T(KC_S)        , KC_G                ,
-        KC_P                , LSFT_T(KC_H)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        ,
-        KC_X                , KC_Q                , KC_M                , KC_W                , KC_Z                ,
-        KC_K                , KC_F                , KC_QUOT             , KC_MINS             , KC_COMM             ,
-                              LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, QK_AREP), LSFT_T(KC_DEL)      ,
-                              LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
-    ),
-    [BASE_DUSK] = LAYOUT_split_3x5_3(
-        KC_B                , KC_F                , KC_D                , KC_W                , KC_P                ,
-        KC_J                , KC_QUOT             , KC_O                , KC_U                , KC_COMM             ,
-        LGUI_T(KC_N)        , LALT_T(KC_S)        , LCTL_T(KC_T)        , LSFT_T(KC_C)        , KC_Y                ,
-        KC_M                , LSFT_T(KC_H)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        ,
-        KC_X                , KC_V                , KC_K                , KC_G                , KC_Q                ,
-        KC_Z                , KC_L                , KC_MINS             , KC_SLSH             , KC_DOT              ,
-                              LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, KC_R) , LSFT_T(QK_AREP)     ,
-                              LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
-    ),
-    [BASE_RACKET] = LAYOUT_split_3x5_3(
-        KC_F                , KC_D                , KC_L                , KC_W                , KC_J                ,
-        KC_MINS             , KC_B                , KC_O                , KC_U                , KC_COMM             ,
-        LGUI_T(KC_S)        , LALT_T(KC_T)        , LCTL_T(KC_H)        , LSFT_T(KC_C)        , KC_Y                ,
-        KC_Q                , LSFT_T(KC_N)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        ,
-        KC_X                , KC_K                , KC_M                , KC_G                , KC_V                ,
-        KC_Z                , KC_P                , KC_QUOT             , KC_SLSH             , KC_DOT              ,
-                              LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, KC_R) , LSFT_T(QK_AREP)     ,
-                              LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
+        1                   , 3                   , 24                  , 37                  , 22                  ,
+        23                  , 16                  , 8                   , 9                   , 10                  ,
+        11                  , 38                  , 39                  , 40                  , 7                   ,
+        6                   , 41                  , 18                  , 19                  , 20                  ,
+        21                  , 5                   , 15                  , 27                  , 25                  ,
+        4                   , 2                   , 26                  , 28                  , 30                  ,
+                              31                  , 42                  , 43                  ,
+                              34                  , 35                  , 36                  
     ),
     [FUN] = LAYOUT_split_3x5_3(
-        KC_F12              , KC_F7               , KC_F8               , KC_F9               , KC_PSCR             ,
-        KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               ,
-        KC_F11              , KC_F4               , KC_F5               , KC_F6               , KC_SCRL             ,
-        KC_NO               , KC_LSFT             , KC_LCTL             , KC_LALT             , KC_LGUI             ,
-        KC_F10              , KC_F1               , KC_F2               , KC_F3               , KC_PAUS             ,
-        KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               ,
-                              KC_APP              , KC_SPC              , KC_TAB              ,
-                              KC_NO               , KC_NO               , KC_NO               
+        44                  , 45                  , 46                  , 47                  , 48                  ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        49                  , 50                  , 51                  , 52                  , 53                  ,
+        0                   , 54                  , 55                  , 56                  , 57                  ,
+        58                  , 59                  , 60                  , 61                  , 62                  ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+                              63                  , 64                  , 65                  ,
+                              0                   , 0                   , 0                   
     ),
     [NUM_NIGHT] = LAYOUT_split_3x5_3(
-        KC_NO               , KC_TILD             , KC_PERC             , KC_COLN             , KC_NO               ,
-        KC_CIRC             , KC_7                , KC_8                , KC_9                , KC_COMM             ,
-        KC_LGUI             , KC_LALT             , KC_LCTL             , KC_LSFT             , KC_PIPE             ,
-        KC_HASH             , KC_1                , KC_2                , KC_3                , KC_GRV              ,
-        LGUI(KC_Z)          , LGUI(KC_X)          , LGUI(KC_C)          , LGUI(KC_V)          , SGUI(KC_Z)          ,
-        KC_DLR              , KC_4                , KC_5                , KC_6                , KC_DOT              ,
-                              KC_NO               , KC_NO               , KC_NO               ,
-                              KC_SLSH             , KC_0                , KC_AT               
+        0                   , 66                  , 67                  , 68                  , 0                   ,
+        69                  , 70                  , 71                  , 72                  , 30                  ,
+        57                  , 56                  , 55                  , 54                  , 73                  ,
+        74                  , 75                  , 76                  , 77                  , 78                  ,
+        79                  , 80                  , 81                  , 82                  , 83                  ,
+        84                  , 85                  , 86                  , 87                  , 10                  ,
+                              0                   , 0                   , 0                   ,
+                              88                  , 89                  , 90                  
     ),
     [SYM_NIGHT] = LAYOUT_split_3x5_3(
-        KC_DLR              , KC_ASTR             , KC_PERC             , KC_COLN             , KC_NO               ,
-        KC_PLUS             , KC_MINS             , KC_LCBR             , KC_RCBR             , KC_COMM             ,
-        KC_LGUI             , KC_LALT             , KC_LCTL             , KC_LSFT             , KC_EQL              ,
-        KC_EXLM             , KC_QUES             , KC_LPRN             , KC_RPRN             , KC_SCLN             ,
-        KC_NO               , KC_NO               , KC_NO               , KC_AMPR             , KC_NO               ,
-        KC_BSLS             , KC_LT               , KC_LBRC             , KC_RBRC             , KC_GT               ,
-                              KC_NO               , KC_NO               , KC_NO               ,
-                              KC_SLSH             , KC_SPC              , KC_ENT              
+        84                  , 91                  , 67                  , 68                  , 0                   ,
+        92                  , 28                  , 93                  , 94                  , 30                  ,
+        57                  , 56                  , 55                  , 54                  , 95                  ,
+        96                  , 97                  , 98                  , 99                  , 29                  ,
+        0                   , 0                   , 0                   , 100                 , 0                   ,
+        101                 , 102                 , 103                 , 104                 , 105                 ,
+                              0                   , 0                   , 0                   ,
+                              88                  , 64                  , 106                 
     ),
     [NAV_NIGHT] = LAYOUT_split_3x5_3(
-        KC_NO               , KC_PGUP             , KC_NO               , KC_NO               , KC_ESC              ,
-        KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               ,
-        KC_NO               , KC_LEFT             , KC_UP               , KC_RGHT             , KC_CAPS             ,
-        KC_NO               , KC_LSFT             , KC_LCTL             , KC_LALT             , KC_LGUI             ,
-        KC_END              , KC_PGDN             , KC_DOWN             , KC_HOME             , KC_INS              ,
-        KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               ,
-                              KC_BSPC             , KC_ENT              , KC_DEL              ,
-                              KC_NO               , KC_NO               , KC_NO               
+        0                   , 107                 , 0                   , 0                   , 108                 ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 109                 , 110                 , 111                 , 112                 ,
+        0                   , 54                  , 55                  , 56                  , 57                  ,
+        113                 , 114                 , 115                 , 116                 , 117                 ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+                              118                 , 106                 , 119                 ,
+                              0                   , 0                   , 0                   
     ),
     [MEDIA_NIGHT] = LAYOUT_split_3x5_3(
-        DF(BASE_NIGHT)      , DF(BASE_GALLIUM)    , DF(BASE_DUSK)       , DF(BASE_RACKET)     , KC_NO               ,
-        KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               ,
-        KC_MNXT             , KC_VOLU             , KC_VOLD             , KC_MPRV             , KC_NO               ,
-        KC_NO               , KC_LSFT             , KC_LCTL             , KC_LALT             , KC_LGUI             ,
-        LGUI(KC_Z)          , LGUI(KC_X)          , LGUI(KC_C)          , LGUI(KC_V)          , SGUI(KC_Z)          ,
-        KC_NO               , KC_NO               , KC_NO               , KC_NO               , QK_BOOT             ,
-                              KC_MUTE             , KC_MPLY             , KC_MSTP             ,
-                              KC_NO               , KC_NO               , KC_NO               
+        120                 , 121                 , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        122                 , 123                 , 124                 , 125                 , 0                   ,
+        0                   , 54                  , 55                  , 56                  , 57                  ,
+        79                  , 80                  , 81                  , 82                  , 83                  ,
+        0                   , 126                 , 127                 , 128                 , 129                 ,
+                              130                 , 131                 , 132                 ,
+                              0                   , 0                   , 0                   
     ),
 };
 
+// Core introspection references the keymaps symbol directly, so keep a single
+// all-KC_NO placeholder layer and override the weak accessors instead.
+const uint16_t PROGMEM keymaps[1][MATRIX_ROWS][MATRIX_COLS] = {0};
+
+uint8_t keymap_layer_count(void) {
+    return 9;
+}
+
+uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t col) {
+    if (layer_num < 9 && row < MATRIX_ROWS && col < MATRIX_COLS) {
+        uint8_t idx = pgm_read_byte(&keymap_indices[layer_num][row][col]);
+        return pgm_read_word(&keymap_dict[idx]);
+    }
+    return KC_NO;
+}
+
+
+#ifdef CHORDAL_HOLD
+// Thumb key positions (canonical row-wise 30-35) mapped through the board's
+// LAYOUT macro. 1 = thumb (exempt from the opposite-hand rule), 0 = alpha.
+// Read by is_thumb_position() in dario.c.
+const uint8_t PROGMEM thumb_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT_split_3x5_3(
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+                              1                   , 1                   , 1                   ,
+                              1                   , 1                   , 1                   
+    );
+
+// Handedness per key ('L'/'R'; thumbs '*' = either hand), read by QMK's
+// chordal_hold_handedness() from get_chordal_hold() in dario.c.
+const char PROGMEM chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] = LAYOUT_split_3x5_3(
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 ,
+        'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 ,
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 ,
+        'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 ,
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 ,
+        'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 ,
+                              '*'                 , '*'                 , '*'                 ,
+                              '*'                 , '*'                 , '*'                 
+    );
+#endif  // CHORDAL_HOLD
+
+
+// Home row mod positions (canonical row-wise 10-19), derived from the
+// compiled BASE_* layers. 1 = home row mod (TAPPING_TERM_HRM), 0 = default.
+// Read by get_tapping_term() in dario.c.
+const uint8_t PROGMEM hrm_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT_split_3x5_3(
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        1                   , 1                   , 1                   , 1                   , 0                   ,
+        0                   , 1                   , 1                   , 1                   , 1                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   ,
+                              0                   , 0                   , 0                   ,
+                              0                   , 0                   , 0                   
+    );
+
 
 #ifdef COMBO_ENABLE
 
@@ -147,20 +321,28 @@ combo_t key_combos[] = {
 
 
 
-// Layer filtering
+// Prior-idle gate + layer filtering. Non-member keys never reach this
+// callback — QMK's process_single_combo returns after the key-list lookup
+// fails — so there is no per-key membership pre-filter to add here.
 bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
+    // Require prior idle (mirrors ZMK's require-prior-idle-ms): mid-burst
+    // keys are never combo candidates, so they skip COMBO_TERM buffering
+    if (!combo_prior_idle_elapsed(record)) {
+        return false;
+    }
+
     uint8_t layer = get_current_base_layer();
 
     switch (combo_index) {
         case COMBO_DFU_LEFT:
-            // Only active on BASE_NIGHT, BASE_GALLIUM, BASE_DUSK, BASE_RACKET
-            return (layer == BASE_NIGHT || layer == BASE_GALLIUM || layer == BASE_DUSK || layer == BASE_RACKET);
+            // Only active on BASE_NIGHT, BASE_GALLIUM
+            return (layer == BASE_NIGHT || layer == BASE_GALLIUM);
         case COMBO_DFU_RIGHT:
-            // Only active on BASE_NIGHT, BASE_GALLIUM, BASE_DUSK, BASE_RACKET
-            return (layer == BASE_NIGHT || layer == BASE_GALLIUM || layer == BASE_DUSK || layer == BASE_RACKET);
+            // Only active on BASE_NIGHT, BASE_GALLIUM
+            return (layer == BASE_NIGHT || layer == BASE_GALLIUM);
         case COMBO_GITHUB_URL:
-            // Only active on BASE_NIGHT, BASE_GALLIUM, BASE_DUSK, BASE_RACKET
-            return (layer == BASE_NIGHT || layer == BASE_GALLIUM || layer == BASE_DUSK || layer == BASE_RACKET);
+            // Only active on BASE_NIGHT, BASE_GALLIUM
+            return (layer == BASE_NIGHT || layer == BASE_GALLIUM);
         default:
             return true;  // Other combos active on all layers
     }
@@ -169,134 +351,121 @@ bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode
 #endif  // COMBO_ENABLE
 
 // Magic key configuration (alternate repeat key)
-uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
-    // Get current base layer (not active overlay)
-    uint8_t base_layer = get_current_base_layer();
-    
-    // BASE_GALLIUM family
-    if (base_layer == BASE_GALLIUM) {
-        switch (keycode) {
-            case KC_DOT: return KC_SLSH;
-            case KC_A: return KC_Y;
-            case KC_B: return KC_R;
-            case KC_C: return KC_S;
-            case KC_E: return KC_Y;
-            case KC_G: return KC_S;
-            case KC_M: return KC_B;
-            case KC_O: return KC_K;
-            case KC_P: return KC_H;
-            case KC_R: return KC_L;
-            case KC_S: return KC_C;
-            case KC_U: return KC_E;
-            case KC_Y: return KC_E;
-        }
-    }
+// Per-base-layer (keycode, alt) pairs sorted by HID keycode value for
+// binary search. Tables live in PROGMEM to keep RAM/flash cost small.
+typedef struct {
+    uint16_t keycode;
+    uint16_t alt;
+} magic_pair_t;
 
-    // BASE_NIGHT family
-    if (base_layer == BASE_NIGHT) {
-        switch (keycode) {
-            case KC_SPC: return MAGIC_NIGHT_CHR_32;
-            case KC_COMM: return MAGIC_NIGHT_CHR_44;
-            case KC_MINS: return KC_GT;
-            case KC_DOT: return KC_SLSH;
-            case KC_A: return KC_O;
-            case KC_B: return MAGIC_NIGHT_B;
-            case KC_C: return KC_Y;
-            case KC_G: return KC_Y;
-            case KC_H: return KC_L;
-            case KC_I: return MAGIC_NIGHT_I;
-            case KC_J: return MAGIC_NIGHT_J;
-            case KC_M: return MAGIC_NIGHT_M;
-            case KC_N: return MAGIC_NIGHT_N;
-            case KC_P: return KC_Y;
-            case KC_Q: return MAGIC_NIGHT_Q;
-            case KC_T: return MAGIC_NIGHT_T;
-            case KC_U: return KC_E;
-            case KC_V: return KC_S;
-            case KC_W: return MAGIC_NIGHT_W;
-            case KC_Y: return KC_QUOT;
-        }
-    }
+static const magic_pair_t PROGMEM magic_pairs_base_gallium[] = {
+    {KC_A      , KC_Y},
+    {KC_B      , KC_R},
+    {KC_C      , KC_S},
+    {KC_E      , KC_Y},
+    {KC_G      , KC_S},
+    {KC_M      , KC_B},
+    {KC_O      , KC_K},
+    {KC_P      , KC_H},
+    {KC_R      , KC_L},
+    {KC_S      , KC_C},
+    {KC_U      , KC_E},
+    {KC_Y      , KC_E},
+    {KC_DOT    , KC_SLSH},
+};
 
-    // BASE_DUSK family
-    if (base_layer == BASE_DUSK) {
-        switch (keycode) {
-            case KC_SPC: return MAGIC_DUSK_CHR_32;
-            case KC_COMM: return MAGIC_DUSK_CHR_44;
-            case KC_DOT: return KC_SLSH;
-        }
-    }
+static const magic_pair_t PROGMEM magic_pairs_base_night[] = {
+    {KC_A      , KC_O},
+    {KC_B      , MAGIC_NIGHT_B},
+    {KC_C      , KC_Y},
+    {KC_G      , KC_Y},
+    {KC_H      , KC_L},
+    {KC_I      , MAGIC_NIGHT_I},
+    {KC_J      , MAGIC_NIGHT_J},
+    {KC_M      , MAGIC_NIGHT_M},
+    {KC_N      , MAGIC_NIGHT_N},
+    {KC_P      , KC_Y},
+    {KC_Q      , MAGIC_NIGHT_Q},
+    {KC_T      , MAGIC_NIGHT_T},
+    {KC_U      , KC_E},
+    {KC_V      , KC_S},
+    {KC_W      , MAGIC_NIGHT_W},
+    {KC_Y      , KC_QUOT},
+    {KC_SPC    , MAGIC_NIGHT_CHR_32},
+    {KC_MINS   , KC_GT},
+    {KC_COMM   , MAGIC_NIGHT_CHR_44},
+    {KC_DOT    , KC_SLSH},
+};
 
-    // BASE_RACKET family
-    if (base_layer == BASE_RACKET) {
-        switch (keycode) {
-            case KC_DOT: return KC_SLSH;
-            case KC_SPC: return MAGIC_RACKET_CHR_32;
-            case KC_COMM: return MAGIC_RACKET_CHR_44;
-            case KC_MINS: return KC_GT;
+static uint16_t magic_pair_lookup(const magic_pair_t *pairs, uint8_t count, uint16_t keycode) {
+    uint8_t lo = 0;
+    uint8_t hi = count;
+    while (lo < hi) {
+        uint8_t mid = (uint8_t)((lo + hi) / 2);
+        uint16_t key = pgm_read_word(&pairs[mid].keycode);
+        if (key == keycode) {
+            return pgm_read_word(&pairs[mid].alt);
+        }
+        if (key < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
+    return QK_REP;  // Default: REPEAT
+}
 
-    // Default: repeat previous key
+uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
+    // Dispatch on current base layer (not active overlay)
+    switch (get_current_base_layer()) {
+        case BASE_GALLIUM:
+            return magic_pair_lookup(magic_pairs_base_gallium, ARRAY_SIZE(magic_pairs_base_gallium), keycode);
+        case BASE_NIGHT:
+            return magic_pair_lookup(magic_pairs_base_night, ARRAY_SIZE(magic_pairs_base_night), keycode);
+    }
     return QK_REP;
 }
 
 
+// Expansion text pool: 10 macros deduplicated into 35 bytes (8 unique strings; shared
+// suffixes reuse the same terminator). One quoted segment per pooled string;
+// adjacent literals concatenate, so embedded NULs stay unambiguous.
+static const char magic_pool[] PROGMEM =
+    "efore\0"  // offset 0
+    " but\0"  // offset 6
+    "hich\0"  // offset 11
+    "ent\0"  // offset 16
+    "ion\0"  // offset 20
+    "the\0"  // offset 24
+    "ust\0"  // offset 28
+    "ue\0";  // offset 32
+
+// Pool offset per macro, indexed by keycode - MAGIC_NIGHT_B
+static const uint8_t magic_pool_offsets[] PROGMEM = {
+      0,  // MAGIC_NIGHT_B -> "efore"
+     24,  // MAGIC_NIGHT_CHR_32 -> "the"
+      6,  // MAGIC_NIGHT_CHR_44 -> " but"
+     21,  // MAGIC_NIGHT_I -> "on"
+     28,  // MAGIC_NIGHT_J -> "ust"
+     16,  // MAGIC_NIGHT_M -> "ent"
+     20,  // MAGIC_NIGHT_N -> "ion"
+     32,  // MAGIC_NIGHT_Q -> "ue"
+     20,  // MAGIC_NIGHT_T -> "ion"
+     11,  // MAGIC_NIGHT_W -> "hich"
+};
+
 bool process_magic_record(uint16_t keycode, keyrecord_t *record) {
-    if (!record->event.pressed) {
+    if (keycode < MAGIC_NIGHT_B || keycode > MAGIC_NIGHT_W) {
         return true;
     }
-    switch (keycode) {
-        case MAGIC_DUSK_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_DUSK_CHR_44:
-            SEND_STRING(" but");
-            return false;
-        case MAGIC_NIGHT_B:
-            SEND_STRING("efore");
-            return false;
-        case MAGIC_NIGHT_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_NIGHT_CHR_44:
-            SEND_STRING(" but");
-            return false;
-        case MAGIC_NIGHT_I:
-            SEND_STRING("on");
-            return false;
-        case MAGIC_NIGHT_J:
-            SEND_STRING("ust");
-            return false;
-        case MAGIC_NIGHT_M:
-            SEND_STRING("ent");
-            return false;
-        case MAGIC_NIGHT_N:
-            SEND_STRING("ion");
-            return false;
-        case MAGIC_NIGHT_Q:
-            SEND_STRING("ue");
-            return false;
-        case MAGIC_NIGHT_T:
-            SEND_STRING("ion");
-            return false;
-        case MAGIC_NIGHT_W:
-            SEND_STRING("hich");
-            return false;
-        case MAGIC_RACKET_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_RACKET_CHR_44:
-            SEND_STRING(" but");
-            return false;
+    if (record->event.pressed) {
+        send_queue_string_P(&magic_pool[pgm_read_byte(&magic_pool_offsets[keycode - MAGIC_NIGHT_B])]);
     }
-    return true;
+    return false;
 }
 
 uint16_t magic_training_first_keycode(uint16_t keycode) {
     switch (keycode) {
-        case MAGIC_DUSK_CHR_32: return KC_NO;
-        case MAGIC_DUSK_CHR_44: return KC_NO;
         case MAGIC_NIGHT_B: return KC_NO;
         case MAGIC_NIGHT_CHR_32: return KC_NO;
         case MAGIC_NIGHT_CHR_44: return KC_NO;
@@ -307,8 +476,6 @@ uint16_t magic_training_first_keycode(uint16_t keycode) {
         case MAGIC_NIGHT_Q: return KC_NO;
         case MAGIC_NIGHT_T: return KC_NO;
         case MAGIC_NIGHT_W: return KC_NO;
-        case MAGIC_RACKET_CHR_32: return KC_NO;
-        case MAGIC_RACKET_CHR_44: return KC_NO;
     }
     return keycode;
 }
@@ -5,14 +5,9 @@
 
 #include "dario.h"
 
-#ifndef MACRO_GITHUB_URL
-#define MACRO_GITHUB_URL SAFE_RANGE
-#endif
-
+// Continues after the shared custom keycodes in dario.h
 enum magic_macros {
-    MAGIC_DUSK_CHR_32 = MACRO_GITHUB_URL + 1,
-    MAGIC_DUSK_CHR_44,
-    MAGIC_NIGHT_B,
+    MAGIC_NIGHT_B = CUSTOM_KEYCODES_END,
     MAGIC_NIGHT_CHR_32,
     MAGIC_NIGHT_CHR_44,
     MAGIC_NIGHT_I,
@@ -22,12 +17,12 @@ enum magic_macros {
     MAGIC_NIGHT_Q,
     MAGIC_NIGHT_T,
     MAGIC_NIGHT_W,
-    MAGIC_RACKET_CHR_32,
-    MAGIC_RACKET_CHR_44,
 };
 
 
-const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+// Pruned (not in this board's base_layers allowlist): BASE_DUSK, BASE_GALLIUM, BASE_RACKET.
+// Their slots zero-fill to KC_NO; shared layer indices from dario.h stay valid.
+const uint16_t PROGMEM keymaps[9][MATRIX_ROWS][MATRIX_COLS] = {
     [BASE_NIGHT] = LAYOUT(
         KC_PMNS             , KC_PSLS             , KC_PAST             , KC_P7               , KC_P8               , KC_P9               , KC_P4               , KC_P5               , KC_P6               , KC_PPLS             , KC_P1               , KC_P2               ,
         KC_P3               , KC_PENT             , KC_NUM_LOCK         , KC_P0               , KC_P0               , KC_PDOT             , KC_PENT             , KC_PEQL             , KC_BSPC             , KC_ESC              , KC_TAB              , KC_B                ,
@@ -35,27 +30,6 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
         LGUI_T(KC_N)        , LALT_T(KC_S)        , LCTL_T(KC_H)        , LSFT_T(KC_T)        , KC_M                , KC_Y                , LSFT_T(KC_C)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        , KC_ENT              , KC_X                , KC_V                , KC_J                ,
         KC_D                , KC_Z                , KC_QUOT             , KC_W                , KC_MINS             , KC_SCLN             , KC_COMM             , LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, KC_R) , LSFT_T(QK_AREP)     , LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
     ),
-    [BASE_GALLIUM] = LAYOUT(
-        KC_PMNS             , KC_PSLS             , KC_PAST             , KC_P7               , KC_P8               , KC_P9               , KC_P4               , KC_P5               , KC_P6               , KC_PPLS             , KC_P1               , KC_P2               ,
-        KC_P3               , KC_PENT             , KC_NUM_LOCK         , KC_P0               , KC_P0               , KC_PDOT             , KC_PENT             , KC_PEQL             , KC_BSPC             , KC_ESC              , KC_TAB              , KC_B                ,
-        KC_L                , KC_D                , KC_C                , KC_V                , KC_J                , KC_Y                , KC_O                , KC_U                , KC_DOT              , KC_BSPC             , KC_DEL              , KC_CAPS             ,
-        LGUI_T(KC_N)        , LALT_T(KC_R)        , LCTL_T(KC_T)        , LSFT_T(KC_S)        , KC_G                , KC_P                , LSFT_T(KC_H)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        , KC_ENT              , KC_X                , KC_Q                , KC_M                ,
-        KC_W                , KC_Z                , KC_K                , KC_F                , KC_QUOT             , KC_MINS             , KC_COMM             , LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, QK_AREP), LSFT_T(KC_DEL)      , LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
-    ),
-    [BASE_DUSK] = LAYOUT(
-        KC_PMNS             , KC_PSLS             , KC_PAST             , KC_P7               , KC_P8               , KC_P9               , KC_P4               , KC_P5               , KC_P6               , KC_PPLS             , KC_P1               , KC_P2               ,
-        KC_P3               , KC_PENT             , KC_NUM_LOCK         , KC_P0               , KC_P0               , KC_PDOT             , KC_PENT             , KC_PEQL             , KC_BSPC             , KC_ESC              , KC_TAB              , KC_B                ,
-        KC_F                , KC_D                , KC_W                , KC_P                , KC_J                , KC_QUOT             , KC_O                , KC_U                , KC_COMM             , KC_BSPC             , KC_DEL              , KC_CAPS             ,
-        LGUI_T(KC_N)        , LALT_T(KC_S)        , LCTL_T(KC_T)        , LSFT_T(KC_C)        , KC_Y                , KC_M                , LSFT_T(KC_H)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        , KC_ENT              , KC_X                , KC_V                , KC_K                ,
-        KC_G                , KC_Q                , KC_Z                , KC_L                , KC_MINS             , KC_SLSH             , KC_DOT              , LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, KC_R) , LSFT_T(QK_AREP)     , LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
-    ),
-    [BASE_RACKET] = LAYOUT(
-        KC_PMNS             , KC_PSLS             , KC_PAST             , KC_P7               , KC_P8               , KC_P9               , KC_P4               , KC_P5               , KC_P6               , KC_PPLS             , KC_P1               , KC_P2               ,
-        KC_P3               , KC_PENT             , KC_NUM_LOCK         , KC_P0               , KC_P0               , KC_PDOT             , KC_PENT             , KC_PEQL             , KC_BSPC             , KC_ESC              , KC_TAB              , KC_F                ,
-        KC_D                , KC_L                , KC_W                , KC_J                , KC_MINS             , KC_B                , KC_O                , KC_U                , KC_COMM             , KC_BSPC             , KC_DEL              , KC_CAPS             ,
-        LGUI_T(KC_S)        , LALT_T(KC_T)        , LCTL_T(KC_H)        , LSFT_T(KC_C)        , KC_Y                , KC_Q                , LSFT_T(KC_N)        , LCTL_T(KC_A)        , LALT_T(KC_E)        , LGUI_T(KC_I)        , KC_ENT              , KC_X                , KC_K                , KC_M                ,
-        KC_G                , KC_V                , KC_Z                , KC_P                , KC_QUOT             , KC_SLSH             , KC_DOT              , LT(NUM_NIGHT, KC_BSPC), LT(SYM_NIGHT, KC_R) , LSFT_T(QK_AREP)     , LSFT_T(KC_TAB)      , LT(NAV_NIGHT, KC_SPC), LT(MEDIA_NIGHT, KC_ENT)
-    ),
     [FUN] = LAYOUT(
         KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             ,
         KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_F12              ,
@@ -87,13 +61,49 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     [MEDIA_NIGHT] = LAYOUT(
         KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             ,
         KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , KC_TRNS             , DF(BASE_NIGHT)      ,
-        DF(BASE_GALLIUM)    , DF(BASE_DUSK)       , DF(BASE_RACKET)     , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_TRNS             , KC_TRNS             , KC_TRNS             ,
+        KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_TRNS             , KC_TRNS             , KC_TRNS             ,
         KC_MNXT             , KC_VOLU             , KC_VOLD             , KC_MPRV             , KC_NO               , KC_NO               , KC_LSFT             , KC_LCTL             , KC_LALT             , KC_LGUI             , KC_TRNS             , LGUI(KC_Z)          , LGUI(KC_X)          , LGUI(KC_C)          ,
-        LGUI(KC_V)          , SGUI(KC_Z)          , KC_NO               , KC_NO               , KC_NO               , KC_NO               , QK_BOOT             , KC_MUTE             , KC_MPLY             , KC_MSTP             , KC_NO               , KC_NO               , KC_NO               
+        LGUI(KC_V)          , SGUI(KC_Z)          , KC_NO               , THSTAT_DUMP         , PERF_TOGG           , TRACE_TOGG          , QK_BOOT             , KC_MUTE             , KC_MPLY             , KC_MSTP             , KC_NO               , KC_NO               , KC_NO               
     ),
 };
 
 
+#ifdef CHORDAL_HOLD
+// Thumb key positions (canonical row-wise 30-35) mapped through the board's
+// LAYOUT macro. 1 = thumb (exempt from the opposite-hand rule), 0 = alpha.
+// Read by is_thumb_position() in dario.c.
+const uint8_t PROGMEM thumb_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 1                   , 1                   , 1                   , 1                   , 1                   , 1                   
+    );
+
+// Handedness per key ('L'/'R'; thumbs '*' = either hand), read by QMK's
+// chordal_hold_handedness() from get_chordal_hold() in dario.c.
+const char PROGMEM chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+        'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 ,
+        'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'L'                 , 'L'                 , 'L'                 ,
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'L'                 ,
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'L'                 , 'L'                 , 'L'                 ,
+        'L'                 , 'L'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , '*'                 , '*'                 , '*'                 , '*'                 , '*'                 , '*'                 
+    );
+#endif  // CHORDAL_HOLD
+
+
+// Home row mod positions (canonical row-wise 10-19), derived from the
+// compiled BASE_* layers. 1 = home row mod (TAPPING_TERM_HRM), 0 = default.
+// Read by get_tapping_term() in dario.c.
+const uint8_t PROGMEM hrm_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        1                   , 1                   , 1                   , 1                   , 0                   , 0                   , 1                   , 1                   , 1                   , 1                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   
+    );
+
+
 #ifdef COMBO_ENABLE
 
 // Combo indices
@@ -120,20 +130,28 @@ combo_t key_combos[] = {
 
 
 
-// Layer filtering
+// Prior-idle gate + layer filtering. Non-member keys never reach this
+// callback — QMK's process_single_combo returns after the key-list lookup
+// fails — so there is no per-key membership pre-filter to add here.
 bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
+    // Require prior idle (mirrors ZMK's require-prior-idle-ms): mid-burst
+    // keys are never combo candidates, so they skip COMBO_TERM buffering
+    if (!combo_prior_idle_elapsed(record)) {
+        return false;
+    }
+
     uint8_t layer = get_current_base_layer();
 
     switch (combo_index) {
         case COMBO_DFU_LEFT:
-            // Only active on BASE_NIGHT, BASE_GALLIUM, BASE_DUSK, BASE_RACKET
-            return (layer == BASE_NIGHT || layer == BASE_GALLIUM || layer == BASE_DUSK || layer == BASE_RACKET);
+            // Only active on BASE_NIGHT
+            return (layer == BASE_NIGHT);
         case COMBO_DFU_RIGHT:
-            // Only active on BASE_NIGHT, BASE_GALLIUM, BASE_DUSK, BASE_RACKET
-            return (layer == BASE_NIGHT || layer == BASE_GALLIUM || layer == BASE_DUSK || layer == BASE_RACKET);
+            // Only active on BASE_NIGHT
+            return (layer == BASE_NIGHT);
         case COMBO_GITHUB_URL:
-            // Only active on BASE_NIGHT, BASE_GALLIUM, BASE_DUSK, BASE_RACKET
-            return (layer == BASE_NIGHT || layer == BASE_GALLIUM || layer == BASE_DUSK || layer == BASE_RACKET);
+            // Only active on BASE_NIGHT
+            return (layer == BASE_NIGHT);
         default:
             return true;  // Other combos active on all layers
     }
@@ -142,134 +160,103 @@ bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode
 #endif  // COMBO_ENABLE
 
 // Magic key configuration (alternate repeat key)
-uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
-    // Get current base layer (not active overlay)
-    uint8_t base_layer = get_current_base_layer();
-    
-    // BASE_GALLIUM family
-    if (base_layer == BASE_GALLIUM) {
-        switch (keycode) {
-            case KC_DOT: return KC_SLSH;
-            case KC_A: return KC_Y;
-            case KC_B: return KC_R;
-            case KC_C: return KC_S;
-            case KC_E: return KC_Y;
-            case KC_G: return KC_S;
-            case KC_M: return KC_B;
-            case KC_O: return KC_K;
-            case KC_P: return KC_H;
-            case KC_R: return KC_L;
-            case KC_S: return KC_C;
-            case KC_U: return KC_E;
-            case KC_Y: return KC_E;
-        }
-    }
+// Per-base-layer (keycode, alt) pairs sorted by HID keycode value for
+// binary search. Tables live in PROGMEM to keep RAM/flash cost small.
+typedef struct {
+    uint16_t keycode;
+    uint16_t alt;
+} magic_pair_t;
 
-    // BASE_NIGHT family
-    if (base_layer == BASE_NIGHT) {
-        switch (keycode) {
-            case KC_SPC: return MAGIC_NIGHT_CHR_32;
-            case KC_COMM: return MAGIC_NIGHT_CHR_44;
-            case KC_MINS: return KC_GT;
-            case KC_DOT: return KC_SLSH;
-            case KC_A: return KC_O;
-            case KC_B: return MAGIC_NIGHT_B;
-            case KC_C: return KC_Y;
-            case KC_G: return KC_Y;
-            case KC_H: return KC_L;
-            case KC_I: return MAGIC_NIGHT_I;
-            case KC_J: return MAGIC_NIGHT_J;
-            case KC_M: return MAGIC_NIGHT_M;
-            case KC_N: return MAGIC_NIGHT_N;
-            case KC_P: return KC_Y;
-            case KC_Q: return MAGIC_NIGHT_Q;
-            case KC_T: return MAGIC_NIGHT_T;
-            case KC_U: return KC_E;
-            case KC_V: return KC_S;
-            case KC_W: return MAGIC_NIGHT_W;
-            case KC_Y: return KC_QUOT;
-        }
-    }
+static const magic_pair_t PROGMEM magic_pairs_base_night[] = {
+    {KC_A      , KC_O},
+    {KC_B      , MAGIC_NIGHT_B},
+    {KC_C      , KC_Y},
+    {KC_G      , KC_Y},
+    {KC_H      , KC_L},
+    {KC_I      , MAGIC_NIGHT_I},
+    {KC_J      , MAGIC_NIGHT_J},
+    {KC_M      , MAGIC_NIGHT_M},
+    {KC_N      , MAGIC_NIGHT_N},
+    {KC_P      , KC_Y},
+    {KC_Q      , MAGIC_NIGHT_Q},
+    {KC_T      , MAGIC_NIGHT_T},
+    {KC_U      , KC_E},
+    {KC_V      , KC_S},
+    {KC_W      , MAGIC_NIGHT_W},
+    {KC_Y      , KC_QUOT},
+    {KC_SPC    , MAGIC_NIGHT_CHR_32},
+    {KC_MINS   , KC_GT},
+    {KC_COMM   , MAGIC_NIGHT_CHR_44},
+    {KC_DOT    , KC_SLSH},
+};
 
-    // BASE_DUSK family
-    if (base_layer == BASE_DUSK) {
-        switch (keycode) {
-            case KC_SPC: return MAGIC_DUSK_CHR_32;
-            case KC_COMM: return MAGIC_DUSK_CHR_44;
-            case KC_DOT: return KC_SLSH;
+static uint16_t magic_pair_lookup(const magic_pair_t *pairs, uint8_t count, uint16_t keycode) {
+    uint8_t lo = 0;
+    uint8_t hi = count;
+    while (lo < hi) {
+        uint8_t mid = (uint8_t)((lo + hi) / 2);
+        uint16_t key = pgm_read_word(&pairs[mid].keycode);
+        if (key == keycode) {
+            return pgm_read_word(&pairs[mid].alt);
         }
-    }
-
-    // BASE_RACKET family
-    if (base_layer == BASE_RACKET) {
-        switch (keycode) {
-            case KC_DOT: return KC_SLSH;
-            case KC_SPC: return MAGIC_RACKET_CHR_32;
-            case KC_COMM: return MAGIC_RACKET_CHR_44;
-            case KC_MINS: return KC_GT;
+        if (key < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
+    return QK_REP;  // Default: REPEAT
+}
 
-    // Default: repeat previous key
+uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
+    // Dispatch on current base layer (not active overlay)
+    switch (get_current_base_layer()) {
+        case BASE_NIGHT:
+            return magic_pair_lookup(magic_pairs_base_night, ARRAY_SIZE(magic_pairs_base_night), keycode);
+    }
     return QK_REP;
 }
 
 
+// Expansion text pool: 10 macros deduplicated into 35 bytes (8 unique strings; shared
+// suffixes reuse the same terminator). One quoted segment per pooled string;
+// adjacent literals concatenate, so embedded NULs stay unambiguous.
+static const char magic_pool[] PROGMEM =
+    "efore\0"  // offset 0
+    " but\0"  // offset 6
+    "hich\0"  // offset 11
+    "ent\0"  // offset 16
+    "ion\0"  // offset 20
+    "the\0"  // offset 24
+    "ust\0"  // offset 28
+    "ue\0";  // offset 32
+
+// Pool offset per macro, indexed by keycode - MAGIC_NIGHT_B
+static const uint8_t magic_pool_offsets[] PROGMEM = {
+      0,  // MAGIC_NIGHT_B -> "efore"
+     24,  // MAGIC_NIGHT_CHR_32 -> "the"
+      6,  // MAGIC_NIGHT_CHR_44 -> " but"
+     21,  // MAGIC_NIGHT_I -> "on"
+     28,  // MAGIC_NIGHT_J -> "ust"
+     16,  // MAGIC_NIGHT_M -> "ent"
+     20,  // MAGIC_NIGHT_N -> "ion"
+     32,  // MAGIC_NIGHT_Q -> "ue"
+     20,  // MAGIC_NIGHT_T -> "ion"
+     11,  // MAGIC_NIGHT_W -> "hich"
+};
+
 bool process_magic_record(uint16_t keycode, keyrecord_t *record) {
-    if (!record->event.pressed) {
+    if (keycode < MAGIC_NIGHT_B || keycode > MAGIC_NIGHT_W) {
         return true;
     }
-    switch (keycode) {
-        case MAGIC_DUSK_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_DUSK_CHR_44:
-            SEND_STRING(" but");
-            return false;
-        case MAGIC_NIGHT_B:
-            SEND_STRING("efore");
-            return false;
-        case MAGIC_NIGHT_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_NIGHT_CHR_44:
-            SEND_STRING(" but");
-            return false;
-        case MAGIC_NIGHT_I:
-            SEND_STRING("on");
-            return false;
-        case MAGIC_NIGHT_J:
-            SEND_STRING("ust");
-            return false;
-        case MAGIC_NIGHT_M:
-            SEND_STRING("ent");
-            return false;
-        case MAGIC_NIGHT_N:
-            SEND_STRING("ion");
-            return false;
-        case MAGIC_NIGHT_Q:
-            SEND_STRING("ue");
-            return false;
-        case MAGIC_NIGHT_T:
-            SEND_STRING("ion");
-            return false;
-        case MAGIC_NIGHT_W:
-            SEND_STRING("hich");
-            return false;
-        case MAGIC_RACKET_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_RACKET_CHR_44:
-            SEND_STRING(" but");
-            return false;
+    if (record->event.pressed) {
+        send_queue_string_P(&magic_pool[pgm_read_byte(&magic_pool_offsets[keycode - MAGIC_NIGHT_B])]);
     }
-    return true;
+    return false;
 }
 
 uint16_t magic_training_first_keycode(uint16_t keycode) {
     switch (keycode) {
-        case MAGIC_DUSK_CHR_32: return KC_NO;
-        case MAGIC_DUSK_CHR_44: return KC_NO;
         case MAGIC_NIGHT_B: return KC_NO;
         case MAGIC_NIGHT_CHR_32: return KC_NO;
         case MAGIC_NIGHT_CHR_44: return KC_NO;
@@ -280,8 +267,6 @@ uint16_t magic_training_first_keycode(uint16_t keycode) {
         case MAGIC_NIGHT_Q: return KC_NO;
         case MAGIC_NIGHT_T: return KC_NO;
         case MAGIC_NIGHT_W: return KC_NO;
-        case MAGIC_RACKET_CHR_32: return KC_NO;
-        case MAGIC_RACKET_CHR_44: return KC_NO;
     }
     return keycode;
 }
@@ -5,12 +5,9 @@
 
 #include "dario.h"
 
-#ifndef MACRO_GITHUB_URL
-#define MACRO_GITHUB_URL SAFE_RANGE
-#endif
-
+// Continues after the shared custom keycodes in dario.h
 enum magic_macros {
-    MAGIC_DUSK_CHR_32 = MACRO_GITHUB_URL + 1,
+    MAGIC_DUSK_CHR_32 = CUSTOM_KEYCODES_END,
     MAGIC_DUSK_CHR_44,
     MAGIC_NIGHT_B,
     MAGIC_NIGHT_CHR_32,
@@ -93,12 +90,48 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
         KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               ,
         KC_NO               , DF(BASE_NIGHT)      , DF(BASE_GALLIUM)    , DF(BASE_DUSK)       , DF(BASE_RACKET)     , KC_NO               , KC_NO               , KC_LSFT             , KC_LCTL             , KC_LALT             , KC_LGUI             , KC_NO               ,
         KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , LGUI(KC_Z)          , LGUI(KC_X)          , LGUI(KC_C)          , LGUI(KC_V)          , SGUI(KC_Z)          ,
-        KC_NO               , KC_MNXT             , KC_VOLU             , KC_VOLD             , KC_MPRV             , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , KC_NO               , QK_BOOT             , KC_NO               ,
+        KC_NO               , KC_MNXT             , KC_VOLU             , KC_VOLD             , KC_MPRV             , KC_NO               , KC_NO               , KC_NO               , KC_NO               , THSTAT_DUMP         , PERF_TOGG           , TRACE_TOGG          , QK_BOOT             , KC_NO               ,
         KC_NO               , KC_MUTE             , KC_MPLY             , KC_MSTP             , KC_NO               , KC_NO               , KC_NO               , KC_NO               
     ),
 };
 
 
+#ifdef CHORDAL_HOLD
+// Thumb key positions (canonical row-wise 30-35) mapped through the board's
+// LAYOUT macro. 1 = thumb (exempt from the opposite-hand rule), 0 = alpha.
+// Read by is_thumb_position() in dario.c.
+const uint8_t PROGMEM thumb_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 1                   , 1                   , 1                   , 1                   , 1                   , 1                   , 0                   
+    );
+
+// Handedness per key ('L'/'R'; thumbs '*' = either hand), read by QMK's
+// chordal_hold_handedness() from get_chordal_hold() in dario.c.
+const char PROGMEM chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 ,
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 ,
+        'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 ,
+        'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'L'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 , 'R'                 ,
+        'L'                 , '*'                 , '*'                 , '*'                 , '*'                 , '*'                 , '*'                 , 'R'                 
+    );
+#endif  // CHORDAL_HOLD
+
+
+// Home row mod positions (canonical row-wise 10-19), derived from the
+// compiled BASE_* layers. 1 = home row mod (TAPPING_TERM_HRM), 0 = default.
+// Read by get_tapping_term() in dario.c.
+const uint8_t PROGMEM hrm_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 1                   , 1                   , 1                   , 1                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 1                   , 1                   , 1                   , 1                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   ,
+        0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   , 0                   
+    );
+
+
 #ifdef COMBO_ENABLE
 
 // Combo indices
@@ -125,8 +158,16 @@ combo_t key_combos[] = {
 
 
 
-// Layer filtering
+// Prior-idle gate + layer filtering. Non-member keys never reach this
+// callback — QMK's process_single_combo returns after the key-list lookup
+// fails — so there is no per-key membership pre-filter to add here.
 bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
+    // Require prior idle (mirrors ZMK's require-prior-idle-ms): mid-burst
+    // keys are never combo candidates, so they skip COMBO_TERM buffering
+    if (!combo_prior_idle_elapsed(record)) {
+        return false;
+    }
+
     uint8_t layer = get_current_base_layer();
 
     switch (combo_index) {
@@ -147,128 +188,138 @@ bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode
 #endif  // COMBO_ENABLE
 
 // Magic key configuration (alternate repeat key)
-uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
-    // Get current base layer (not active overlay)
-    uint8_t base_layer = get_current_base_layer();
-    
-    // BASE_GALLIUM family
-    if (base_layer == BASE_GALLIUM) {
-        switch (keycode) {
-            case KC_DOT: return KC_SLSH;
-            case KC_A: return KC_Y;
-            case KC_B: return KC_R;
-            case KC_C: return KC_S;
-            case KC_E: return KC_Y;
-            case KC_G: return KC_S;
-            case KC_M: return KC_B;
-            case KC_O: return KC_K;
-            case KC_P: return KC_H;
-            case KC_R: return KC_L;
-            case KC_S: return KC_C;
-            case KC_U: return KC_E;
-            case KC_Y: return KC_E;
-        }
-    }
+// Per-base-layer (keycode, alt) pairs sorted by HID keycode value for
+// binary search. Tables live in PROGMEM to keep RAM/flash cost small.
+typedef struct {
+    uint16_t keycode;
+    uint16_t alt;
+} magic_pair_t;
 
-    // BASE_NIGHT family
-    if (base_layer == BASE_NIGHT) {
-        switch (keycode) {
-            case KC_SPC: return MAGIC_NIGHT_CHR_32;
-            case KC_COMM: return MAGIC_NIGHT_CHR_44;
-            case KC_MINS: return KC_GT;
-            case KC_DOT: return KC_SLSH;
-            case KC_A: return KC_O;
-            case KC_B: return MAGIC_NIGHT_B;
-            case KC_C: return KC_Y;
-            case KC_G: return KC_Y;
-            case KC_H: return KC_L;
-            case KC_I: return MAGIC_NIGHT_I;
-            case KC_J: return MAGIC_NIGHT_J;
-            case KC_M: return MAGIC_NIGHT_M;
-            case KC_N: return MAGIC_NIGHT_N;
-            case KC_P: return KC_Y;
-            case KC_Q: return MAGIC_NIGHT_Q;
-            case KC_T: return MAGIC_NIGHT_T;
-            case KC_U: return KC_E;
-            case KC_V: return KC_S;
-            case KC_W: return MAGIC_NIGHT_W;
-            case KC_Y: return KC_QUOT;
-        }
-    }
+static const magic_pair_t PROGMEM magic_pairs_base_gallium[] = {
+    {KC_A      , KC_Y},
+    {KC_B      , KC_R},
+    {KC_C      , KC_S},
+    {KC_E      , KC_Y},
+    {KC_G      , KC_S},
+    {KC_M      , KC_B},
+    {KC_O      , KC_K},
+    {KC_P      , KC_H},
+    {KC_R      , KC_L},
+    {KC_S      , KC_C},
+    {KC_U      , KC_E},
+    {KC_Y      , KC_E},
+    {KC_DOT    , KC_SLSH},
+};
 
-    // BASE_DUSK family
-    if (base_layer == BASE_DUSK) {
-        switch (keycode) {
-            case KC_SPC: return MAGIC_DUSK_CHR_32;
-            case KC_COMM: return MAGIC_DUSK_CHR_44;
-            case KC_DOT: return KC_SLSH;
-        }
-    }
+static const magic_pair_t PROGMEM magic_pairs_base_night[] = {
+    {KC_A      , KC_O},
+    {KC_B      , MAGIC_NIGHT_B},
+    {KC_C      , KC_Y},
+    {KC_G      , KC_Y},
+    {KC_H      , KC_L},
+    {KC_I      , MAGIC_NIGHT_I},
+    {KC_J      , MAGIC_NIGHT_J},
+    {KC_M      , MAGIC_NIGHT_M},
+    {KC_N      , MAGIC_NIGHT_N},
+    {KC_P      , KC_Y},
+    {KC_Q      , MAGIC_NIGHT_Q},
+    {KC_T      , MAGIC_NIGHT_T},
+    {KC_U      , KC_E},
+    {KC_V      , KC_S},
+    {KC_W      , MAGIC_NIGHT_W},
+    {KC_Y      , KC_QUOT},
+    {KC_SPC    , MAGIC_NIGHT_CHR_32},
+    {KC_MINS   , KC_GT},
+    {KC_COMM   , MAGIC_NIGHT_CHR_44},
+    {KC_DOT    , KC_SLSH},
+};
+
+static const magic_pair_t PROGMEM magic_pairs_base_dusk[] = {
+    {KC_SPC    , MAGIC_DUSK_CHR_32},
+    {KC_COMM   , MAGIC_DUSK_CHR_44},
+    {KC_DOT    , KC_SLSH},
+};
 
-    // BASE_RACKET family
-    if (base_layer == BASE_RACKET) {
-        switch (keycode) {
-            case KC_DOT: return KC_SLSH;
-            case KC_SPC: return MAGIC_RACKET_CHR_32;
-            case KC_COMM: return MAGIC_RACKET_CHR_44;
-            case KC_MINS: return KC_GT;
+static const magic_pair_t PROGMEM magic_pairs_base_racket[] = {
+    {KC_SPC    , MAGIC_RACKET_CHR_32},
+    {KC_MINS   , KC_GT},
+    {KC_COMM   , MAGIC_RACKET_CHR_44},
+    {KC_DOT    , KC_SLSH},
+};
+
+static uint16_t magic_pair_lookup(const magic_pair_t *pairs, uint8_t count, uint16_t keycode) {
+    uint8_t lo = 0;
+    uint8_t hi = count;
+    while (lo < hi) {
+        uint8_t mid = (uint8_t)((lo + hi) / 2);
+        uint16_t key = pgm_read_word(&pairs[mid].keycode);
+        if (key == keycode) {
+            return pgm_read_word(&pairs[mid].alt);
+        }
+        if (key < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
+    return QK_REP;  // Default: REPEAT
+}
 
-    // Default: repeat previous key
+uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
+    // Dispatch on current base layer (not active overlay)
+    switch (get_current_base_layer()) {
+        case BASE_GALLIUM:
+            return magic_pair_lookup(magic_pairs_base_gallium, ARRAY_SIZE(magic_pairs_base_gallium), keycode);
+        case BASE_NIGHT:
+            return magic_pair_lookup(magic_pairs_base_night, ARRAY_SIZE(magic_pairs_base_night), keycode);
+        case BASE_DUSK:
+            return magic_pair_lookup(magic_pairs_base_dusk, ARRAY_SIZE(magic_pairs_base_dusk), keycode);
+        case BASE_RACKET:
+            return magic_pair_lookup(magic_pairs_base_racket, ARRAY_SIZE(magic_pairs_base_racket), keycode);
+    }
     return QK_REP;
 }
 
 
+// Expansion text pool: 14 macros deduplicated into 35 bytes (8 unique strings; shared
+// suffixes reuse the same terminator). One quoted segment per pooled string;
+// adjacent literals concatenate, so embedded NULs stay unambiguous.
+static const char magic_pool[] PROGMEM =
+    "efore\0"  // offset 0
+    " but\0"  // offset 6
+    "hich\0"  // offset 11
+    "ent\0"  // offset 16
+    "ion\0"  // offset 20
+    "the\0"  // offset 24
+    "ust\0"  // offset 28
+    "ue\0";  // offset 32
+
+// Pool offset per macro, indexed by keycode - MAGIC_DUSK_CHR_32
+static const uint8_t magic_pool_offsets[] PROGMEM = {
+     24,  // MAGIC_DUSK_CHR_32 -> "the"
+      6,  // MAGIC_DUSK_CHR_44 -> " but"
+      0,  // MAGIC_NIGHT_B -> "efore"
+     24,  // MAGIC_NIGHT_CHR_32 -> "the"
+      6,  // MAGIC_NIGHT_CHR_44 -> " but"
+     21,  // MAGIC_NIGHT_I -> "on"
+     28,  // MAGIC_NIGHT_J -> "ust"
+     16,  // MAGIC_NIGHT_M -> "ent"
+     20,  // MAGIC_NIGHT_N -> "ion"
+     32,  // MAGIC_NIGHT_Q -> "ue"
+     20,  // MAGIC_NIGHT_T -> "ion"
+     11,  // MAGIC_NIGHT_W -> "hich"
+     24,  // MAGIC_RACKET_CHR_32 -> "the"
+      6,  // MAGIC_RACKET_CHR_44 -> " but"
+};
+
 bool process_magic_record(uint16_t keycode, keyrecord_t *record) {
-    if (!record->event.pressed) {
+    if (keycode < MAGIC_DUSK_CHR_32 || keycode > MAGIC_RACKET_CHR_44) {
         return true;
     }
-    switch (keycode) {
-        case MAGIC_DUSK_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_DUSK_CHR_44:
-            SEND_STRING(" but");
-            return false;
-        case MAGIC_NIGHT_B:
-            SEND_STRING("efore");
-            return false;
-        case MAGIC_NIGHT_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_NIGHT_CHR_44:
-            SEND_STRING(" but");
-            return false;
-        case MAGIC_NIGHT_I:
-            SEND_STRING("on");
-            return false;
-        case MAGIC_NIGHT_J:
-            SEND_STRING("ust");
-            return false;
-        case MAGIC_NIGHT_M:
-            SEND_STRING("ent");
-            return false;
-        case MAGIC_NIGHT_N:
-            SEND_STRING("ion");
-            return false;
-        case MAGIC_NIGHT_Q:
-            SEND_STRING("ue");
-            return false;
-        case MAGIC_NIGHT_T:
-            SEND_STRING("ion");
-            return false;
-        case MAGIC_NIGHT_W:
-            SEND_STRING("hich");
-            return false;
-        case MAGIC_RACKET_CHR_32:
-            SEND_STRING("the");
-            return false;
-        case MAGIC_RACKET_CHR_44:
-            SEND_STRING(" but");
-            return false;
+    if (record->event.pressed) {
+        send_queue_string_P(&magic_pool[pgm_read_byte(&magic_pool_offsets[keycode - MAGIC_DUSK_CHR_32])]);
     }
-    return true;
+    return false;
 }
 
 uint16_t magic_training_first_keycode(uint16_t keycode) {
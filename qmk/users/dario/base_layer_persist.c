@@ -0,0 +1,89 @@
+#include "base_layer_persist.h"
+#include "dario.h"
+
+// 8 slots x 2 bytes inside the eeconfig user datablock
+// (EECONFIG_USER_DATA_SIZE in config.h). Each commit advances one slot, so
+// the wear spreads across the ring: at the AVR's ~100k cycles per byte even
+// frequent layout switching never gets near the endurance limit.
+#define PERSIST_SLOT_COUNT 8
+
+// The value byte carries a marker nibble so erased EEPROM (0xFF) and
+// pre-persistence firmware read as "no saved layer" instead of a bogus one
+#define PERSIST_VALUE_MARKER 0xA0
+#define PERSIST_VALUE_MASK   0x0F
+
+// Quiet period after the last base-layer change before committing. Long
+// enough to coalesce flicking through layouts on the MEDIA layer into one
+// write; AVR EEPROM byte writes block ~3ms each, so the cost lands only
+// after the user has stopped interacting.
+#define PERSIST_IDLE_MS 3000
+
+typedef struct {
+    uint8_t seq;    // monotonically increasing commit counter (wraps)
+    uint8_t value;  // PERSIST_VALUE_MARKER | base layer
+} persist_slot_t;
+
+_Static_assert(sizeof(persist_slot_t) * PERSIST_SLOT_COUNT == EECONFIG_USER_DATA_SIZE,
+               "slot ring must exactly fill the eeconfig user datablock");
+
+static persist_slot_t slots[PERSIST_SLOT_COUNT];
+static uint8_t  newest_slot = 0;
+static bool     have_newest = false;
+static bool     dirty       = false;
+static uint32_t dirty_time  = 0;
+
+static bool slot_valid(const persist_slot_t *slot) {
+    // Base layers occupy the enum range below FUN (dario.h)
+    return (slot->value & 0xF0) == PERSIST_VALUE_MARKER
+        && (slot->value & PERSIST_VALUE_MASK) < FUN;
+}
+
+uint8_t base_layer_persist_restore(void) {
+    eeconfig_read_user_datablock(slots);
+
+    for (uint8_t i = 0; i < PERSIST_SLOT_COUNT; i++) {
+        if (!slot_valid(&slots[i])) {
+            continue;
+        }
+        // Wraparound-aware comparison; commit counters only ever differ by
+        // small amounts, so the signed difference picks the newer one
+        if (!have_newest || (int8_t)(slots[i].seq - slots[newest_slot].seq) > 0) {
+            newest_slot = i;
+            have_newest = true;
+        }
+    }
+
+    if (!have_newest) {
+        return BASE_LAYER_PERSIST_NONE;
+    }
+    return slots[newest_slot].value & PERSIST_VALUE_MASK;
+}
+
+void base_layer_persist_mark_dirty(void) {
+    dirty      = true;
+    dirty_time = timer_read32();
+}
+
+void base_layer_persist_task(void) {
+    if (!dirty || timer_elapsed32(dirty_time) < PERSIST_IDLE_MS) {
+        return;
+    }
+    dirty = false;
+
+    uint8_t layer = get_current_base_layer();
+    if (have_newest && (slots[newest_slot].value & PERSIST_VALUE_MASK) == layer) {
+        return;  // Switched away and back within the quiet period
+    }
+
+    uint8_t next = have_newest ? (uint8_t)((newest_slot + 1) % PERSIST_SLOT_COUNT) : 0;
+    uint8_t seq  = have_newest ? (uint8_t)(slots[newest_slot].seq + 1) : 1;
+
+    slots[next].seq   = seq;
+    slots[next].value = PERSIST_VALUE_MARKER | (layer & PERSIST_VALUE_MASK);
+    newest_slot       = next;
+    have_newest       = true;
+
+    // eeprom_update_block underneath only writes bytes that changed, so this
+    // physically touches just the two bytes of the new slot
+    eeconfig_update_user_datablock(slots);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Persistent base-layer selection with deferred, wear-leveled EEPROM writes.
+//
+// set_single_persistent_default_layer() would write EEPROM synchronously
+// inside the keypress handler; instead the DF() tracking in
+// process_record_user() only marks state dirty, and the commit happens from
+// housekeeping after a quiet period, rotating through a slot ring inside the
+// eeconfig user datablock so no single EEPROM byte takes all the wear.
+// Startup restore is a read-only ring scan — no write on the boot path.
+
+// Returned by base_layer_persist_restore() when no valid slot exists
+// (fresh EEPROM or pre-persistence firmware)
+#define BASE_LAYER_PERSIST_NONE 0xFF
+
+// Scan the slot ring and return the last committed base layer,
+// or BASE_LAYER_PERSIST_NONE. Called once from keyboard_post_init_user().
+uint8_t base_layer_persist_restore(void);
+
+// Note a base-layer change; the actual EEPROM commit is deferred
+void base_layer_persist_mark_dirty(void);
+
+// Commit dirty state once the quiet period has elapsed;
+// called from housekeeping_task_user()
+void base_layer_persist_task(void);
@@ -0,0 +1,57 @@
+#include "boot_latency.h"
+#include "trace.h"
+
+#ifndef LAZY_INIT_SCAN_COUNT
+#    define LAZY_INIT_SCAN_COUNT 64
+#endif
+
+static uint32_t scan_count = 0;
+static bool first_key_seen = false;
+#ifdef LAZY_PERIPHERAL_INIT
+static bool peripherals_up = false;
+#endif
+
+void boot_latency_post_init(void) {
+#ifdef LAZY_PERIPHERAL_INIT
+    // Keep the display/LED work out of the early scan loop; boot_latency_task
+    // brings both up once the matrix has had LAZY_INIT_SCAN_COUNT clean passes
+#    ifdef OLED_ENABLE
+    oled_off();
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+    rgb_matrix_set_suspend_state(true);
+#    endif
+#endif
+}
+
+void boot_latency_task(void) {
+    if (scan_count < UINT32_MAX) {
+        scan_count++;
+    }
+
+#ifdef LAZY_PERIPHERAL_INIT
+    if (!peripherals_up && scan_count >= LAZY_INIT_SCAN_COUNT) {
+        peripherals_up = true;
+#    ifdef OLED_ENABLE
+        oled_on();
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+        rgb_matrix_set_suspend_state(false);
+#    endif
+    }
+#endif
+}
+
+void boot_latency_first_key(void) {
+    if (first_key_seen) {
+        return;
+    }
+    first_key_seen = true;
+
+    uint32_t elapsed = timer_read32();
+    uint16_t ms = (elapsed > UINT16_MAX) ? UINT16_MAX : (uint16_t)elapsed;
+    uint16_t scans = (scan_count > UINT16_MAX) ? UINT16_MAX : (uint16_t)scan_count;
+    // trace_emit forwards to the telemetry ring as well, so the replug cost
+    // shows up on both the console and the raw HID dashboard
+    trace_emit(TRACE_BOOT_FIRST_KEY, ms, scans);
+}
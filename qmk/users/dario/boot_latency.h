@@ -0,0 +1,26 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Boot-latency probe and lazy peripheral bring-up.
+//
+// Replugging a board leaves a window where keystrokes land before the
+// peripherals (and the user) are ready. Two pieces:
+//   - The first accepted keystroke after reset is stamped with ms-from-reset
+//     and the scan count, and pushed through the trace/telemetry channel
+//     (TRACE_BOOT_FIRST_KEY), so the replug cost is measurable per board.
+//   - With LAZY_PERIPHERAL_INIT (OPT_DEFS in qmk/config/boards/*.mk) the
+//     OLED and RGB matrix stay dark for the first LAZY_INIT_SCAN_COUNT scan
+//     cycles, keeping the early scan loop free of display/LED work. Core
+//     driver init before the first scan is QMK's, not ours; this defers the
+//     per-scan cost we do control.
+
+// Suspend OLED/RGB at boot when lazy init is enabled; called from
+// keyboard_post_init_user()
+void boot_latency_post_init(void);
+
+// Scan counting and deferred bring-up; called from housekeeping_task_user()
+void boot_latency_task(void);
+
+// Stamp the first accepted keystroke; cheap early-out on every later call
+void boot_latency_first_key(void);
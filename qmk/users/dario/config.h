@@ -62,6 +62,30 @@
 // #define NO_ACTION_MACRO  // REMOVED to enable text expansion macros
 #define NO_ACTION_FUNCTION
 
+// ----------------------------------------------------------------------------
+// OLED (lily58, lulu)
+// ----------------------------------------------------------------------------
+
+// Cap the status screen at 20fps; oled.c only redraws lines whose backing
+// value changed, so most frames transmit nothing over I2C
+#define OLED_UPDATE_INTERVAL 50
+
+// ----------------------------------------------------------------------------
+// SPLIT KEYBOARD DATA SYNC
+// ----------------------------------------------------------------------------
+
+// User split transaction for pushing base-layer state to the slave half
+// (see base_layer_sync_task in dario.c). Ignored on monoblock boards (boaty).
+#define SPLIT_TRANSACTION_IDS_USER RPC_ID_USER_BASE_LAYER
+
+// ----------------------------------------------------------------------------
+// PERSISTENT BASE LAYER
+// ----------------------------------------------------------------------------
+
+// Eeconfig user datablock for the wear-leveling slot ring in
+// base_layer_persist.c (8 slots x 2 bytes)
+#define EECONFIG_USER_DATA_SIZE 16
+
 // ----------------------------------------------------------------------------
 // COMBOS
 // ----------------------------------------------------------------------------
@@ -74,5 +98,9 @@
 // (e.g., dfu_left works on Racket layer even though the keys are different)
 #define COMBO_ONLY_FROM_LAYER 0
 
-// Note: QMK does not have built-in require-prior-idle support for combos
-// This is a ZMK-only feature (require-prior-idle-ms)
+// Userspace require-prior-idle for combos (QMK has no built-in equivalent of
+// ZMK's require-prior-idle-ms): a combo-member key pressed within this window
+// of the previous press bypasses the combo engine entirely, so fast typing
+// never eats the COMBO_TERM buffering delay. Matches the ZMK combos in
+// zmk/config/dario_behaviors.dtsi (require-prior-idle-ms = <150>).
+#define COMBO_REQUIRE_PRIOR_IDLE_MS 150
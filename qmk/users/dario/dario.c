@@ -1,9 +1,17 @@
 #include "dario.h"
+#include "send_queue.h"
+#include "trace.h"
+#include "scan_perf.h"
+#include "taphold_stats.h"
+#include "base_layer_persist.h"
+#include "report_batch.h"
+#include "idle_sleep.h"
+#include "boot_latency.h"
+#include "wpm_lite.h"
 #include "quantum/repeat_key.h"
-
-// Forward declaration: generated per-keymap for magic text expansions
-bool process_magic_record(uint16_t keycode, keyrecord_t *record);
-__attribute__((weak)) bool process_magic_record(uint16_t keycode, keyrecord_t *record) { return true; }
+#ifdef SPLIT_KEYBOARD
+#    include "transactions.h"
+#endif
 
 // Global variable to track current base layer for magic key context
 static uint8_t current_base_layer = BASE_NIGHT;  // Default starting layer
@@ -13,39 +21,76 @@ uint8_t get_current_base_layer(void) {
     return current_base_layer;
 }
 
+#ifdef SPLIT_KEYBOARD
+// Base-layer sync: DF(...) tracking in process_record_user only runs on the
+// master half, so the slave's combo filtering and magic context would drift.
+// A single-byte user transaction pushes the state across when it changes,
+// with a slow periodic resend so a reconnected/reset slave catches back up.
+static void base_layer_sync_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    current_base_layer = *(const uint8_t *)in_data;
+}
+
+static void base_layer_sync_task(void) {
+    static uint8_t  synced_base_layer = 0xFF;  // force an initial push
+    static uint32_t last_sync_time    = 0;
+
+    if (!is_keyboard_master()) {
+        return;
+    }
+
+    // Send on change, retrying at most every 50ms if the transport is busy;
+    // otherwise refresh once a second (one byte/s) to survive slave resets.
+    const bool     changed = synced_base_layer != current_base_layer;
+    const uint32_t elapsed = timer_elapsed32(last_sync_time);
+    if ((changed && elapsed > 50) || elapsed > 1000) {
+        if (transaction_rpc_send(RPC_ID_USER_BASE_LAYER, sizeof(current_base_layer), &current_base_layer)) {
+            synced_base_layer = current_base_layer;
+        }
+        last_sync_time = timer_read32();
+    }
+}
+#endif  // SPLIT_KEYBOARD
+
+void keyboard_post_init_user(void) {
+#ifdef SPLIT_KEYBOARD
+    transaction_register_rpc(RPC_ID_USER_BASE_LAYER, base_layer_sync_slave_handler);
+#endif
+    // Restore the last committed base layer before the first scan. This is a
+    // read-only ring scan; no EEPROM write happens on the boot path.
+    uint8_t saved = base_layer_persist_restore();
+    if (saved != BASE_LAYER_PERSIST_NONE) {
+        current_base_layer = saved;
+        default_layer_set((layer_state_t)1 << saved);
+    }
+
+    report_batch_init();
+    boot_latency_post_init();
+}
+
+// Combo require-prior-idle gate: the generated combo_should_trigger() calls
+// this for combo-member keys, and any press arriving within the idle window of
+// the previous one is rejected as a combo candidate (it's mid-burst typing).
+// The timestamp is updated in process_record_user, which runs *after* the combo
+// engine's buffering decision — so the keys of a chord pressed after an idle
+// pause don't advance the window against each other.
+static uint16_t last_press_timestamp = 0;
+
+bool combo_prior_idle_elapsed(keyrecord_t *record) {
+    return (uint16_t)(record->event.time - last_press_timestamp) >= COMBO_REQUIRE_PRIOR_IDLE_MS;
+}
+
 // Per-key tapping term configuration
-uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
-    switch (keycode) {
-        // Home row mods from all BASE layers: use HRM tapping term (280ms)
-        // BASE_NIGHT: LGUI/LALT/LCTL/LSFT on N/S/H/T (left), LSFT/LCTL/LALT/LGUI on C/A/E/I (right)
-        case LGUI_T(KC_N):
-        case LALT_T(KC_S):
-        case LCTL_T(KC_H):
-        case LSFT_T(KC_T):
-        case LSFT_T(KC_C):
-        case LCTL_T(KC_A):
-        case LALT_T(KC_E):
-        case LGUI_T(KC_I):
-        // BASE_GALLIUM: LGUI/LALT/LCTL/LSFT on N/R/T/S (left), LSFT/LCTL/LALT/LGUI on H/A/E/I (right)
-        case LALT_T(KC_R):
-        // case LSFT_T(KC_T):  // Already listed above (BASE_NIGHT)
-        // case LSFT_T(KC_C):  // Already listed above (BASE_NIGHT - but GALLIUM uses H here)
-        case LSFT_T(KC_H):
-        // case LCTL_T(KC_A):  // Already listed above (BASE_NIGHT)
-        // case LALT_T(KC_E):  // Already listed above (BASE_NIGHT)
-        // case LGUI_T(KC_I):  // Already listed above (BASE_NIGHT)
-            return TAPPING_TERM_HRM;
-
-        // Layer-tap keys: use standard tapping term (200ms)
-        case LT(NAV_NIGHT, KC_SPC):
-        case LT(NUM_NIGHT, KC_BSPC):
-        case LT(SYM_NIGHT, KC_R):
-        case LT(MEDIA_NIGHT, KC_ENT):
-            return 200;
+// Generated per-keymap: 1 at home-row mod positions (canonical 10-19) across
+// all BASE layers; see generate_tapping_term_inline in qmk_generator.py
+extern const uint8_t hrm_positions[MATRIX_ROWS][MATRIX_COLS] PROGMEM;
 
-        default:
-            return TAPPING_TERM;
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    // Home row mods use the longer HRM term (280ms); everything else,
+    // including the layer-tap thumbs, uses the standard term (200ms).
+    if (pgm_read_byte(&hrm_positions[record->event.key.row][record->event.key.col])) {
+        return TAPPING_TERM_HRM;
     }
+    return TAPPING_TERM;
 }
 
 // Per-key hold-on-other-key-press (hold-preferred behavior)
@@ -64,46 +109,49 @@ bool get_hold_on_other_key_press(uint16_t keycode, keyrecord_t *record) {
 // Thumb-aware chordal hold: ignore thumbs so Flow Tap can resolve rolls
 // while still using opposite-hand protection for main alphas.
 #ifdef CHORDAL_HOLD
-static bool is_thumb_keycode(uint16_t keycode) {
-    switch (keycode) {
-        // Thumbs on BASE_NIGHT and BASE_GALLIUM (both use _NIGHT variants)
-        case LT(NUM_NIGHT, KC_BSPC):
-        case LT(SYM_NIGHT, KC_R):
-        case LSFT_T(KC_DEL):
-        case LSFT_T(KC_TAB):
-        case LT(NAV_NIGHT, KC_SPC):
-        case LT(MEDIA_NIGHT, KC_ENT):
-            return true;
-    }
-    return false;
-}
+// Generated per-keymap (canonical thumb positions 30-35 mapped through the
+// board's LAYOUT macro); see generate_chordal_hold_inline in qmk_generator.py
+extern const uint8_t thumb_positions[MATRIX_ROWS][MATRIX_COLS] PROGMEM;
 
-static char handedness_for_keypos(keypos_t key) {
-#ifdef SPLIT_KEYBOARD
-    // On split boards the row index encodes the hand (left rows first, right rows second).
-    return (key.row < (MATRIX_ROWS / 2)) ? 'L' : 'R';
-#else
-    // For monoblock boards, fall back to a column split.
-    return (key.col < (MATRIX_COLS / 2)) ? 'L' : 'R';
-#endif
+static bool is_thumb_position(keypos_t key) {
+    return pgm_read_byte(&thumb_positions[key.row][key.col]) != 0;
 }
 
 bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t *tap_hold_record, uint16_t other_keycode, keyrecord_t *other_record) {
-    if (is_thumb_keycode(tap_hold_keycode) || is_thumb_keycode(other_keycode)) {
+    if (is_thumb_position(tap_hold_record->event.key) || is_thumb_position(other_record->event.key)) {
         return true;  // Never penalize holds when a thumb key is involved
     }
 
-    const char tap_hand   = handedness_for_keypos(tap_hold_record->event.key);
-    const char other_hand = handedness_for_keypos(other_record->event.key);
-    return tap_hand != other_hand;
+    // Handedness comes from the generated chordal_hold_layout table via
+    // QMK's accessor: one PROGMEM load per key instead of split/monoblock
+    // branching, and correct for irregular layouts like the boaty sail.
+    const char tap_hand   = chordal_hold_handedness(tap_hold_record->event.key);
+    const char other_hand = chordal_hold_handedness(other_record->event.key);
+    if (tap_hand == other_hand) {
+        // Same-hand roll settles the would-be hold as a tap; count the
+        // override so the fast path's hit rate is measurable
+        if (pgm_read_byte(&hrm_positions[tap_hold_record->event.key.row][tap_hold_record->event.key.col])) {
+            taphold_stats_record(tap_hold_record, TH_CHORDAL_OVERRIDE);
+        }
+        return false;
+    }
+    return true;
 }
 #endif  // CHORDAL_HOLD
 
 // Custom keycode handler
 // Clipboard keys are handled by macros in dario.h
 bool process_record_user(uint16_t keycode, keyrecord_t *record) {
-    // Track base layer changes for magic key context
     if (record->event.pressed) {
+        last_press_timestamp = record->event.time;  // feeds combo_prior_idle_elapsed
+        boot_latency_first_key();
+        wpm_lite_count_keystroke();
+    }
+
+    // Track base layer changes for magic key context; persistence commits
+    // from housekeeping after a quiet period, never from this handler
+    if (record->event.pressed) {
+        uint8_t prev_base_layer = current_base_layer;
         switch (keycode) {
             case DF(BASE_NIGHT):
                 current_base_layer = BASE_NIGHT;
@@ -118,48 +166,78 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
                 current_base_layer = BASE_RACKET;
                 break;
         }
+        if (current_base_layer != prev_base_layer) {
+            base_layer_persist_mark_dirty();
+        }
     }
 
-    // Light logging for combo-related keys to see if they arrive together
+    // Light tracing for combo-related keys to see if they arrive together
     if (record->event.pressed) {
         switch (keycode) {
+            case TRACE_TOGG:
+                trace_toggle();
+                return false;
+            case PERF_TOGG:
+                scan_perf_toggle_report();
+                return false;
+            case THSTAT_DUMP:
+                taphold_stats_dump();
+                return false;
             case KC_B: case KC_Q: case KC_Z:
             case KC_P: case KC_DOT: case KC_QUOT:
             case KC_G: case KC_O: case KC_U:
-                uprintf("combo-key %u r%u c%u t%u layer=%u\n",
-                        keycode,
-                        record->event.key.row,
-                        record->event.key.col,
-                        record->event.time,
-                        get_highest_layer(layer_state));
+                trace_emit(TRACE_COMBO_KEY, keycode,
+                           ((uint16_t)record->event.key.row << 8) | record->event.key.col);
                 break;
         }
     }
 
-    // Delegate magic/alternate repeat handling
-    if (!magic_process_record(keycode, record)) {
-        return false;
+    // Tap-hold telemetry: process_record runs after tap/hold settlement, so
+    // tap.count tells us how each home-row mod resolved
+    if (record->event.pressed) {
+        if (IS_QK_MOD_TAP(keycode) && pgm_read_byte(&hrm_positions[record->event.key.row][record->event.key.col])) {
+            taphold_stats_record(record, record->tap.count > 0 ? TH_RESOLVED_TAP : TH_RESOLVED_HOLD);
+        }
+        taphold_stats_note_press(record);
     }
 
-    if (!process_magic_record(keycode, record)) {
+    // Delegate magic/alternate repeat handling (single dispatch; magic macro
+    // keycodes are range-checked and routed to the generated handler inside)
+    if (!magic_process_record(keycode, record)) {
         return false;
     }
 
     switch (keycode) {
         case MACRO_GITHUB_URL:
             if (record->event.pressed) {
-                SEND_STRING("https://github.com/daranguiz/keyboard-config?tab=readme-ov-file#readme");
+                send_queue_string_P(PSTR("https://github.com/daranguiz/keyboard-config?tab=readme-ov-file#readme"));
             }
             return false;
     }
     return true;
 }
 
-// Combo debug logging: prints combo index + press/release to QMK console
+// Drain queued text expansions and trace events between matrix scans;
+// housekeeping runs once per scan loop, so it also drives scan telemetry
+void housekeeping_task_user(void) {
+    scan_perf_task();
+    boot_latency_task();
+    wpm_lite_task();
+    send_queue_task();
+    trace_task();
+    taphold_stats_task();
+    base_layer_persist_task();
+#ifdef SPLIT_KEYBOARD
+    base_layer_sync_task();
+#endif
+    // Last: flush the coalesced HID report after all event processing
+    report_batch_task();
+    // After the flush: may block for the throttled interval when idle
+    idle_sleep_task();
+}
+
+// Combo debug tracing: records combo index + press/release + active layer
 void process_combo_event(uint16_t combo_index, bool pressed) {
-    uprintf("combo %u %s layer=%u state=%lu\n",
-            combo_index,
-            pressed ? "down" : "up",
-            get_highest_layer(layer_state),
-            (unsigned long)layer_state);
+    trace_emit(TRACE_COMBO_EVENT, combo_index,
+               ((uint16_t)get_highest_layer(layer_state) << 8) | (pressed ? 1 : 0));
 }
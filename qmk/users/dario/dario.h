@@ -2,6 +2,8 @@
 
 #include QMK_KEYBOARD_H
 
+#include "send_queue.h"  // Async text output for magic expansions/macros
+
 // Layer definitions
 // NOTE: Order must match config/keymap.yaml layer order
 enum layers {
@@ -21,14 +23,23 @@ enum layers {
 #define U_NU KC_NO  // key available but not used
 #define U_NP KC_NO  // key is not present
 
-// Text expansion macros
+// Text expansion macros and utility keycodes
+// NOTE: Generated magic macro keycodes continue from CUSTOM_KEYCODES_END
 enum custom_macros {
-    MACRO_GITHUB_URL = SAFE_RANGE
+    MACRO_GITHUB_URL = SAFE_RANGE,
+    TRACE_TOGG,   // Toggle trace buffer capture (see trace.h)
+    PERF_TOGG,    // Toggle scan telemetry console report (see scan_perf.h)
+    THSTAT_DUMP,  // Dump tap-hold resolution stats (see taphold_stats.h)
+    CUSTOM_KEYCODES_END
 };
 
 // Base layer tracking for magic key context
 uint8_t get_current_base_layer(void);
 
+// Combo require-prior-idle gate (see COMBO_REQUIRE_PRIOR_IDLE_MS in config.h);
+// called from the generated combo_should_trigger() in keymap.c
+bool combo_prior_idle_elapsed(keyrecord_t *record);
+
 bool magic_process_record(uint16_t keycode, keyrecord_t *record);
 
 // RGB aliases (conditional on RGB support)
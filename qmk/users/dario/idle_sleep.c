@@ -0,0 +1,66 @@
+#include "idle_sleep.h"
+
+#ifndef IDLE_SLEEP_ENABLE
+
+// No sleep_timeout_s knob for this board: keep the housekeeping call site
+// linkable at zero cost
+void idle_sleep_task(void) {}
+bool idle_sleep_is_idle(void) { return false; }
+
+#else
+
+#ifndef IDLE_SLEEP_TIMEOUT_MS
+#    define IDLE_SLEEP_TIMEOUT_MS 600000UL
+#endif
+
+// Throttled scan interval while idle; also the wake-latency bound. 8ms is
+// slow enough to let the MCU sit in the WFI loop most of the time but still
+// well under anything a human can perceive on the first keystroke.
+#ifndef IDLE_SLEEP_SCAN_INTERVAL_MS
+#    define IDLE_SLEEP_SCAN_INTERVAL_MS 8
+#endif
+
+static bool is_idle = false;
+
+static void enter_idle(void) {
+    is_idle = true;
+#    ifdef OLED_ENABLE
+    oled_off();
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+    rgb_matrix_set_suspend_state(true);
+#    endif
+}
+
+static void leave_idle(void) {
+    is_idle = false;
+#    ifdef OLED_ENABLE
+    oled_on();
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+    rgb_matrix_set_suspend_state(false);
+#    endif
+}
+
+void idle_sleep_task(void) {
+    const bool quiet = last_input_activity_elapsed() >= IDLE_SLEEP_TIMEOUT_MS;
+    if (quiet != is_idle) {
+        if (quiet) {
+            enter_idle();
+        } else {
+            leave_idle();
+        }
+    }
+    if (is_idle) {
+        // Matrix scanning continues between passes, so the wait only caps the
+        // loop rate; the first keystroke resets last_input_activity and the
+        // next pass (at most one interval away) un-gates everything
+        wait_ms(IDLE_SLEEP_SCAN_INTERVAL_MS);
+    }
+}
+
+bool idle_sleep_is_idle(void) {
+    return is_idle;
+}
+
+#endif  // IDLE_SLEEP_ENABLE
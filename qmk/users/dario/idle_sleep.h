@@ -0,0 +1,19 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Idle low-power mode for boards that sit connected but untouched for hours
+// (lulu and friends). After IDLE_SLEEP_TIMEOUT_MS without input the scan loop
+// is throttled to one pass per IDLE_SLEEP_SCAN_INTERVAL_MS and the OLED/RGB
+// are gated off; the first keystroke is picked up by the next throttled scan,
+// so wake latency is bounded by one scan interval.
+//
+// The knobs are projected from sleep_timeout_s in config/boards.yaml into
+// OPT_DEFS in qmk/config/boards/<board>.mk by scripts/generate.py; boards
+// without the knob compile the no-op stub.
+
+// Per-scan bookkeeping and throttling; called from housekeeping_task_user()
+void idle_sleep_task(void);
+
+// Whether the board is currently in the throttled idle state (for the OLED)
+bool idle_sleep_is_idle(void);
@@ -1,6 +1,6 @@
 #include "dario.h"
+#include "trace.h"
 #include "quantum/repeat_key.h"
-#include "print.h"
 #include "action_layer.h"
 #include "quantum/quantum_keycodes.h"
 
@@ -10,19 +10,16 @@ extern bool process_magic_record(uint16_t keycode, keyrecord_t *record);
 // Training helper generated in keymap.c (maps magic macro to its first key)
 __attribute__((weak)) uint16_t magic_training_first_keycode(uint16_t keycode) { return keycode; }
 
-#define MAGIC_LOG(...) uprintf(__VA_ARGS__)
-
-// Track previous tapped key for training (independent of QK_REP tracking)
-static uint16_t training_prev_key = KC_NO;
-static uint8_t training_prev_mods = 0;
-
-static void magic_debug_banner(void) {
-    static bool shown = false;
-    if (!shown) {
-        MAGIC_LOG("MAGIC_DEBUG ON\n");
-        shown = true;
-    }
-}
+// Shared last-key tracker, updated once per keystroke from the repeat-key
+// remember hook. Both consumers — the magic (alternate repeat) key and
+// training mode — read the same state, so they can never disagree about
+// what the magic key will produce. The expected next key is memoized when
+// the tracker updates, so the per-press training check is a single
+// comparison instead of re-running the magic lookup chain.
+static uint16_t last_tap_keycode = KC_NO;
+static uint8_t  last_tap_mods = 0;
+static uint16_t training_expected = KC_NO;
+static uint8_t  training_expected_layer = 0;
 
 static uint16_t unwrap_tap_keycode(uint16_t keycode) {
     if (IS_QK_MOD_TAP(keycode)) {
@@ -39,6 +36,19 @@ static uint16_t unwrap_tap_keycode(uint16_t keycode) {
     return keycode;
 }
 
+// unwrap_tap_keycode is pure, so a single-entry memo caps the cost at one
+// real unwrap per event even though process_record and both repeat-key
+// hooks all ask for the tap keycode of the same keystroke
+static uint16_t event_tap_keycode(uint16_t keycode) {
+    static uint16_t memo_wrapped = KC_NO;
+    static uint16_t memo_tap = KC_NO;
+    if (keycode != memo_wrapped) {
+        memo_wrapped = keycode;
+        memo_tap = unwrap_tap_keycode(keycode);
+    }
+    return memo_tap;
+}
+
 static bool is_magic_tap_action(uint16_t keycode, keyrecord_t *record) {
     if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
         return record->tap.count > 0 && !record->tap.interrupted;
@@ -46,139 +56,115 @@ static bool is_magic_tap_action(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
+// Memoize the key the training check should expect after this tap; runs once
+// per keystroke (from the remember hook) instead of inside the press decision
+static void last_key_update(uint16_t tap, uint8_t mods) {
+    last_tap_keycode = tap;
+    last_tap_mods = mods;
+    training_expected_layer = get_current_base_layer();
+    uint16_t alt = get_alt_repeat_key_keycode_user(tap, mods);
+    training_expected = magic_training_first_keycode(alt);
+}
+
 // Core handler for alternate repeat tap (magic) key
 static bool handle_magic_tap(uint16_t keycode, keyrecord_t *record) {
-    MAGIC_LOG("AREP trigger raw=%u tap=%u layer=%u\n",
-              keycode,
-              unwrap_tap_keycode(keycode),
-              get_highest_layer(layer_state));
+    trace_emit(TRACE_AREP_TRIGGER, keycode, event_tap_keycode(keycode));
 
-    uint16_t last_key = unwrap_tap_keycode(get_last_keycode());
-    const uint8_t last_mods = get_last_mods();
+    const uint16_t last_key  = last_tap_keycode;
+    const uint8_t  last_mods = last_tap_mods;
     const uint16_t alt = get_alt_repeat_key_keycode_user(last_key, last_mods);
 
-    MAGIC_LOG("AREP key=%u layer=%u last=%u mods=%u alt=%u\n",
-              keycode,
-              get_highest_layer(layer_state),
-              last_key,
-              last_mods,
-              alt);
+    trace_emit(TRACE_AREP_RESOLVE, last_key, alt);
 
     // If the alternate is one of our magic macros/text-expansions, let keymap.c handle it
     keyrecord_t fake = *record;
     fake.event.pressed = true;
     if (!process_magic_record(alt, &fake)) {
-        MAGIC_LOG("AREP alt macro consumed\n");
         return false;
     }
 
     // Default repeat fallback: if no mapping, repeat the last key
     if (alt == QK_REP) {
-        MAGIC_LOG("AREP default repeat key=%u mods=%u\n", last_key, last_mods);
+        trace_emit(TRACE_AREP_REPEAT, last_key, last_mods);
         tap_code16(last_key);
         return false;
     }
 
     // Otherwise send the alternate keycode directly; rely on current mods already active
-    MAGIC_LOG("AREP tapping alt=%u\n", alt);
     tap_code16(alt);
     return false;
 }
 
 // Prevent repeat keys from overwriting the remembered "last key"
 bool get_repeat_key_eligible_user(uint16_t keycode, keyrecord_t *record, uint8_t *remembered_mods) {
-    magic_debug_banner();
-    uint16_t tap = unwrap_tap_keycode(keycode);
     switch (keycode) {
         case QK_REP:
         case QK_AREP:
             return false;
         default:
-            if (tap == QK_AREP) {
+            if (event_tap_keycode(keycode) == QK_AREP) {
                 return false;
             }
             return true;
     }
 }
 
-// Log the last key remembered by repeat key (when MAGIC_DEBUG is enabled)
+// Single update point for the shared tracker; the repeat-key module calls
+// this after the press decision, so the training check in
+// magic_process_record still sees the previous key
 bool remember_last_key_user(uint16_t keycode, keyrecord_t *record, uint8_t *remembered_mods) {
-    magic_debug_banner();
-    uint16_t tap = unwrap_tap_keycode(keycode);
+    uint16_t tap = event_tap_keycode(keycode);
     if (tap == QK_AREP) {
-        MAGIC_LOG("REMEMBER skip magic key=%u raw=%u layer=%u\n",
-                  tap,
-                  keycode,
-                  get_highest_layer(layer_state));
+        trace_emit(TRACE_REMEMBER_SKIP, tap, keycode);
         return false;
     }
-    MAGIC_LOG("REMEMBER key=%u mods=%u layer=%u\n",
-              tap,
-              *remembered_mods,
-              get_highest_layer(layer_state));
+    last_key_update(tap, *remembered_mods);
+    trace_emit(TRACE_REMEMBER, tap, *remembered_mods);
     return true;  // keep default remember logic
 }
 
 bool magic_process_record(uint16_t keycode, keyrecord_t *record) {
-    magic_debug_banner();
+    // Magic macro keycodes (generated enum, synthesized by combos or the
+    // alternate-repeat path) dispatch straight to the generated handler;
+    // a single range check replaces the old second weak-symbol call that
+    // ran its full switch on every ordinary keystroke.
+    if (keycode >= CUSTOM_KEYCODES_END) {
+        return process_magic_record(keycode, record);
+    }
 
-    uint16_t tap = unwrap_tap_keycode(keycode);
+    uint16_t tap = event_tap_keycode(keycode);
     const bool is_magic_mod_tap = IS_QK_MOD_TAP(keycode) && tap == QK_AREP;
 
     // Training mode: if the previous key would trigger a magic alternate that
-    // matches this key, emit '#' instead to encourage using MAGIC.
-    // Note: get_alt_repeat_key_keycode_user uses base layer tracking internally
+    // matches this key, emit '#' instead to encourage using MAGIC. The
+    // tracker itself advances afterwards, in remember_last_key_user.
     if (record->event.pressed && tap != QK_AREP && tap != QK_REP && is_magic_tap_action(keycode, record)) {
-        uint16_t last_key = unwrap_tap_keycode(training_prev_key);
-        uint16_t alt = get_alt_repeat_key_keycode_user(last_key, training_prev_mods);
-        uint16_t expected = magic_training_first_keycode(alt);
-        MAGIC_LOG("TRAIN check last=%u alt=%u expected=%u key=%u layer=%u\n",
-                  last_key,
-                  alt,
-                  expected,
-                  tap,
-                  get_highest_layer(layer_state));
-        if (expected == tap && expected != QK_REP && expected != KC_NO) {
-            MAGIC_LOG("TRAIN block last=%u alt=%u key=%u layer=%u\n",
-                      last_key,
-                      alt,
-                      expected,
-                      get_highest_layer(layer_state));
+        // The expected key was memoized against the base layer active at the
+        // time; recompute only if the base layer changed since
+        if (training_expected_layer != get_current_base_layer()) {
+            last_key_update(last_tap_keycode, last_tap_mods);
+        }
+        trace_emit(TRACE_TRAIN_CHECK, last_tap_keycode, training_expected);
+        if (training_expected == tap && training_expected != QK_REP && training_expected != KC_NO) {
+            trace_emit(TRACE_TRAIN_BLOCK, training_expected, tap);
             tap_code16(KC_HASH);
             return false;
         }
-
-        // Update training tracker after evaluating
-        training_prev_key = tap;
-        training_prev_mods = get_mods();
     }
 
     // For mod-tap magic key: only treat as tap on release when it was a real tap.
     if (is_magic_mod_tap) {
+        trace_emit(TRACE_AREP_MODTAP, keycode,
+                   ((uint16_t)record->tap.count << 8) | (record->tap.interrupted ? 1 : 0));
         if (record->event.pressed) {
-            MAGIC_LOG("AREP modtap press raw=%u tapcnt=%u interrupted=%u layer=%u\n",
-                      keycode,
-                      record->tap.count,
-                      record->tap.interrupted,
-                      get_highest_layer(layer_state));
             return true;  // allow normal mod-tap processing (hold = shift)
         }
 
         // Release: tap.count==0 means it was a hold (shift). Non-zero == tap.
         if (record->tap.count == 0 || record->tap.interrupted) {
-            MAGIC_LOG("AREP modtap hold skip raw=%u tapcnt=%u interrupted=%u layer=%u\n",
-                      keycode,
-                      record->tap.count,
-                      record->tap.interrupted,
-                      get_highest_layer(layer_state));
             return true;
         }
 
-        MAGIC_LOG("AREP modtap tap raw=%u tapcnt=%u interrupted=%u layer=%u\n",
-                  keycode,
-                  record->tap.count,
-                  record->tap.interrupted,
-                  get_highest_layer(layer_state));
         return handle_magic_tap(keycode, record);
     }
 
@@ -188,12 +174,7 @@ bool magic_process_record(uint16_t keycode, keyrecord_t *record) {
     }
 
     if (tap == QK_REP) {
-        MAGIC_LOG("REP trigger raw=%u tap=%u layer=%u last=%u mods=%u\n",
-                  keycode,
-                  tap,
-                  get_highest_layer(layer_state),
-                  unwrap_tap_keycode(get_last_keycode()),
-                  get_last_mods());
+        trace_emit(TRACE_REP, last_tap_keycode, last_tap_mods);
     }
 
     return true;
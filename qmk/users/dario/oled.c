@@ -0,0 +1,102 @@
+#ifdef OLED_ENABLE
+
+#include "dario.h"
+#include "scan_perf.h"
+#include "wpm_lite.h"
+
+// Shared OLED status screen for the boards with displays (lily58, lulu).
+//
+// Dirty-line rendering: each status line remembers the value it last drew and
+// is only re-composed and re-written when that value changes, so a static
+// screen costs a handful of compares per frame and no I2C page traffic (the
+// oled driver only transmits pages whose buffer contents changed). The frame
+// rate itself is capped by OLED_UPDATE_INTERVAL in users/dario/config.h.
+
+static const char *layer_name(void) {
+    switch (get_highest_layer(layer_state | default_layer_state)) {
+        case BASE_NIGHT:   return "NIGHT";
+        case BASE_GALLIUM: return "GALLIUM";
+        case BASE_DUSK:    return "DUSK";
+        case BASE_RACKET:  return "RACKET";
+        case FUN:          return "FUN";
+        case NUM_NIGHT:    return "NUM";
+        case SYM_NIGHT:    return "SYM";
+        case NAV_NIGHT:    return "NAV";
+        case MEDIA_NIGHT:  return "MEDIA";
+        default:           return "???";
+    }
+}
+
+// Fixed line assignments so a dirty line can be redrawn in place
+enum oled_line {
+    LINE_LAYER,
+    LINE_MODS,
+#ifdef WPM_LITE_ENABLE
+    LINE_WPM,
+#endif
+    LINE_SCAN_RATE,
+    LINE_SCAN_LATENCY,
+};
+
+static void render_line(uint8_t line, const char *text) {
+    oled_set_cursor(0, line);
+    oled_write_ln(text, false);
+}
+
+bool oled_task_user(void) {
+    char line[22];
+
+    // Layer names are static strings, so pointer comparison suffices
+    static const char *last_layer = NULL;
+    const char        *layer      = layer_name();
+    if (layer != last_layer) {
+        last_layer = layer;
+        snprintf(line, sizeof(line), "Layer: %s", layer);
+        render_line(LINE_LAYER, line);
+    }
+
+    static uint8_t last_mods = 0xFF;
+    const uint8_t  mods      = get_mods();
+    if (mods != last_mods) {
+        last_mods = mods;
+        line[0]   = (mods & MOD_MASK_GUI) ? 'G' : '-';
+        line[1]   = (mods & MOD_MASK_ALT) ? 'A' : '-';
+        line[2]   = (mods & MOD_MASK_CTRL) ? 'C' : '-';
+        line[3]   = (mods & MOD_MASK_SHIFT) ? 'S' : '-';
+        line[4]   = '\0';
+        render_line(LINE_MODS, line);
+    }
+
+#ifdef WPM_LITE_ENABLE
+    static uint8_t last_wpm = 0xFF;
+    const uint8_t  wpm      = wpm_lite_get();
+    if (wpm != last_wpm) {
+        last_wpm = wpm;
+        snprintf(line, sizeof(line), "WPM %u", wpm);
+        render_line(LINE_WPM, line);
+    }
+#endif
+
+    // Scan telemetry only advances once per 1s window, so these lines
+    // redraw at most once a second
+    scan_perf_stats_t stats = scan_perf_snapshot();
+
+    static uint16_t last_rate = 0xFFFF;
+    if (stats.scans_per_sec != last_rate) {
+        last_rate = stats.scans_per_sec;
+        snprintf(line, sizeof(line), "Scan %u/s", stats.scans_per_sec);
+        render_line(LINE_SCAN_RATE, line);
+    }
+
+    static uint16_t last_latency = 0xFFFF;
+    const uint16_t  latency      = ((uint16_t)stats.p99_interval_ms << 8) | stats.max_interval_ms;
+    if (latency != last_latency) {
+        last_latency = latency;
+        snprintf(line, sizeof(line), "p99 %ums max %ums", stats.p99_interval_ms, stats.max_interval_ms);
+        render_line(LINE_SCAN_LATENCY, line);
+    }
+
+    return false;
+}
+
+#endif  // OLED_ENABLE
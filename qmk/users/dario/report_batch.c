@@ -0,0 +1,63 @@
+#include "report_batch.h"
+#include "host.h"
+#include "report.h"
+
+static host_driver_t     batching_driver;
+static host_driver_t    *real_driver = NULL;
+static report_keyboard_t pending;
+static bool              pending_dirty = false;
+
+// True if `next` clears any bit that `pending` has set. Works byte-wise for
+// both report formats: NKRO bitmap bits and 6KRO key slots (del_key zeroes
+// the slot) both read as 1→0 transitions, and the mods byte comes along for
+// free. Conservative — a false positive just costs one extra report.
+static bool has_removals(const report_keyboard_t *next) {
+    const uint8_t *prev_bytes = (const uint8_t *)&pending;
+    const uint8_t *next_bytes = (const uint8_t *)next;
+    for (uint8_t i = 0; i < sizeof(report_keyboard_t); i++) {
+        if (prev_bytes[i] & (uint8_t)~next_bytes[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void flush_pending(void) {
+    if (!pending_dirty || real_driver == NULL) {
+        return;
+    }
+    pending_dirty = false;
+    real_driver->send_keyboard(&pending);
+}
+
+static void batched_send_keyboard(report_keyboard_t *report) {
+    // A release of a key the host never saw (press and release resolved in
+    // the same scan) must not coalesce away: flush the press first
+    if (pending_dirty && has_removals(report)) {
+        flush_pending();
+    }
+    pending       = *report;
+    pending_dirty = true;
+}
+
+void report_batch_init(void) {
+    host_driver_t *driver = host_get_driver();
+    if (driver == NULL || driver == &batching_driver) {
+        return;  // USB not up yet, or already installed
+    }
+    real_driver = driver;
+    // Pass everything except keyboard reports straight through
+    batching_driver               = *real_driver;
+    batching_driver.send_keyboard = batched_send_keyboard;
+    host_set_driver(&batching_driver);
+}
+
+void report_batch_task(void) {
+    if (real_driver == NULL) {
+        // keyboard_post_init_user can run before the protocol driver is
+        // registered on some targets; keep retrying from the scan loop
+        report_batch_init();
+        return;
+    }
+    flush_pending();
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Coalesced HID report batching for chorded key events.
+//
+// QMK_KEYS_PER_SCAN 4 (config.h) lets one scan resolve a whole chord, but
+// every register/unregister still emits its own HID report, so a three-key
+// chord costs three USB transactions with host-visible skew between them.
+// This module wraps the host driver: send_keyboard() calls only stage the
+// report, and housekeeping flushes the final state once per scan — a chord
+// or roll resolved in one scan reaches the host as a single NKRO report.
+//
+// Releases of keys the host has not seen yet (e.g. tap_code press+release
+// inside one scan) flush the pending press first, so no tap can coalesce
+// into nothing.
+
+// Install the batching wrapper around the current host driver;
+// called from keyboard_post_init_user() (retried from the task until
+// the USB driver is up)
+void report_batch_init(void);
+
+// Flush the staged report; called last from housekeeping_task_user()
+// so it runs after all event processing in the scan
+void report_batch_task(void);
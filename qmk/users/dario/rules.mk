@@ -9,6 +9,11 @@ REPEAT_KEY_ENABLE = yes     # QK_REP / QK_AREP support
 COMBO_ENABLE = yes          # Key combos
 COMMAND_ENABLE = no         # Commands for debug and configuration
 
+# Raw HID telemetry channel (telemetry.c + scripts/telemetry_dashboard.py):
+# fixed 32-byte reports only when the host polls, so it is cheap enough to
+# keep on everywhere — including the boards where console is off below
+RAW_ENABLE = yes
+
 # Console for magic debugging:
 #  - Disable on V-USB (endpoint conflict)
 #  - Disable on AVR (size) ; keep on for other MCUs
@@ -21,7 +26,4 @@ else
 endif
 
 # Include shared source files
-SRC += dario.c magic.c
-
-# Magic logging always on
-CPPFLAGS += -DMAGIC_DEBUG
+SRC += dario.c magic.c send_queue.c trace.c scan_perf.c oled.c taphold_stats.c telemetry.c base_layer_persist.c report_batch.c idle_sleep.c boot_latency.c wpm_lite.c
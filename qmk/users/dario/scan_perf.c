@@ -0,0 +1,86 @@
+#include "scan_perf.h"
+#include "print.h"
+
+// Inter-scan interval histogram buckets: 0ms (sub-millisecond), 1ms, 2ms,
+// 3ms, and 4ms-or-worse. Millisecond timer resolution is enough here: a
+// healthy scan loop lands almost everything in bucket 0, so the interesting
+// signal is how often (and how far) scans spill into the upper buckets.
+#define SCAN_PERF_BUCKETS 5
+#define SCAN_PERF_WINDOW_MS 1000
+
+static uint16_t bucket_counts[SCAN_PERF_BUCKETS];
+static uint16_t scan_count      = 0;
+static uint8_t  max_interval_ms = 0;
+static uint32_t last_scan_time  = 0;
+static uint32_t window_start    = 0;
+
+static scan_perf_stats_t last_window;
+static bool report_enabled = false;
+
+static uint8_t histogram_p99(uint16_t total) {
+    // Walk down from the worst bucket until we pass 1% of scans
+    uint16_t threshold = total / 100;
+    uint16_t seen = 0;
+    for (int8_t bucket = SCAN_PERF_BUCKETS - 1; bucket > 0; bucket--) {
+        seen += bucket_counts[bucket];
+        if (seen > threshold) {
+            return (uint8_t)bucket;
+        }
+    }
+    return 0;
+}
+
+static void close_window(uint32_t now) {
+    uint32_t window_ms = now - window_start;
+    if (window_ms == 0 || scan_count == 0) {
+        return;
+    }
+
+    last_window.scans_per_sec = (uint16_t)((uint32_t)scan_count * 1000 / window_ms);
+    // Mean scan duration in µs, fixed point: window_us / scans
+    last_window.mean_scan_us = (uint16_t)(window_ms * 1000 / scan_count);
+    last_window.p99_interval_ms = histogram_p99(scan_count);
+    last_window.max_interval_ms = max_interval_ms;
+
+    if (report_enabled) {
+        uprintf("scan %u/s mean=%uus p99=%ums max=%ums\n",
+                last_window.scans_per_sec,
+                last_window.mean_scan_us,
+                last_window.p99_interval_ms,
+                last_window.max_interval_ms);
+    }
+
+    for (uint8_t i = 0; i < SCAN_PERF_BUCKETS; i++) {
+        bucket_counts[i] = 0;
+    }
+    scan_count      = 0;
+    max_interval_ms = 0;
+    window_start    = now;
+}
+
+void scan_perf_task(void) {
+    uint32_t now = timer_read32();
+
+    uint32_t interval = now - last_scan_time;
+    last_scan_time = now;
+
+    uint8_t bucket = (interval >= SCAN_PERF_BUCKETS) ? (SCAN_PERF_BUCKETS - 1) : (uint8_t)interval;
+    bucket_counts[bucket]++;
+    scan_count++;
+    if (interval > max_interval_ms) {
+        max_interval_ms = (interval > UINT8_MAX) ? UINT8_MAX : (uint8_t)interval;
+    }
+
+    if (now - window_start >= SCAN_PERF_WINDOW_MS) {
+        close_window(now);
+    }
+}
+
+void scan_perf_toggle_report(void) {
+    report_enabled = !report_enabled;
+    uprintf("scan report %s\n", report_enabled ? "on" : "off");
+}
+
+scan_perf_stats_t scan_perf_snapshot(void) {
+    return last_window;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Matrix scan-rate and latency telemetry.
+//
+// Counts scan-loop iterations (via housekeeping_task_user, which runs once
+// per scan) and buckets inter-scan intervals so we can see what
+// QMK_KEYS_PER_SCAN / debounce tuning actually achieves on each MCU.
+// Numbers are exposed two ways:
+//   - PERF_TOGG keycode toggles a 1Hz console report
+//   - scan_perf_snapshot() feeds the OLED status screen (lily58/lulu)
+
+typedef struct {
+    uint16_t scans_per_sec;   // scan loop iterations in the last 1s window
+    uint16_t mean_scan_us;    // mean scan duration, microseconds
+    uint8_t  p99_interval_ms; // 99th percentile inter-scan interval (ms, 4 = 4+)
+    uint8_t  max_interval_ms; // worst inter-scan interval seen in the window
+} scan_perf_stats_t;
+
+// Per-scan bookkeeping; called from housekeeping_task_user()
+void scan_perf_task(void);
+
+// Toggle the periodic console report (bound to PERF_TOGG)
+void scan_perf_toggle_report(void);
+
+// Stats from the last completed 1s window (for the OLED readout)
+scan_perf_stats_t scan_perf_snapshot(void);
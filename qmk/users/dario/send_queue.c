@@ -0,0 +1,47 @@
+#include "send_queue.h"
+
+// Ring buffer sized to hold the longest queued expansion (the GitHub URL
+// macro is ~70 characters). Must be a power of two for the cheap index mask.
+#define SEND_QUEUE_SIZE 128
+#define SEND_QUEUE_MASK (SEND_QUEUE_SIZE - 1)
+
+static char    queue[SEND_QUEUE_SIZE];
+static uint8_t queue_head = 0;  // next char to emit
+static uint8_t queue_tail = 0;  // next free slot
+
+static uint8_t queue_len(void) {
+    return (uint8_t)(queue_tail - queue_head) & SEND_QUEUE_MASK;
+}
+
+static void queue_push(char c) {
+    // Drop on overflow rather than block the scan loop; the buffer is sized
+    // so this only happens if many long expansions are chained back-to-back.
+    if (queue_len() == SEND_QUEUE_SIZE - 1) {
+        return;
+    }
+    queue[queue_tail & SEND_QUEUE_MASK] = c;
+    queue_tail++;
+}
+
+void send_queue_string(const char *str) {
+    while (*str) {
+        queue_push(*str++);
+    }
+}
+
+void send_queue_string_P(const char *str) {
+    char c;
+    while ((c = pgm_read_byte(str++)) != '\0') {
+        queue_push(c);
+    }
+}
+
+void send_queue_task(void) {
+    if (queue_head == queue_tail) {
+        return;
+    }
+    // One character per scan keeps the per-pass cost bounded; at typical
+    // 1kHz scan rates this still types far faster than SEND_STRING needs to.
+    send_char(queue[queue_head & SEND_QUEUE_MASK]);
+    queue_head++;
+}
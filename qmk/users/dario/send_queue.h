@@ -0,0 +1,20 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Non-blocking replacement for SEND_STRING in magic expansions and macros.
+//
+// SEND_STRING types the whole string inside process_record_user(), stalling
+// the matrix scan loop for the duration. These helpers instead queue the
+// characters into a small ring buffer (a few microseconds) and emit them one
+// per scan from housekeeping_task_user(), so scan latency stays flat no
+// matter how long the expansion is.
+
+// Queue a RAM string for asynchronous typing
+void send_queue_string(const char *str);
+
+// Queue a PROGMEM string for asynchronous typing (use with PSTR())
+void send_queue_string_P(const char *str);
+
+// Drain one queued character; called from housekeeping_task_user() in dario.c
+void send_queue_task(void);
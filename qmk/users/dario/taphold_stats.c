@@ -0,0 +1,123 @@
+#include "taphold_stats.h"
+#include "print.h"
+
+#ifndef CONSOLE_ENABLE
+
+// No console, no dump channel: keep the hooks as empty stubs so call sites
+// in dario.c stay unconditional (LTO strips them)
+void taphold_stats_record(keyrecord_t *record, uint8_t resolution) {}
+void taphold_stats_note_press(keyrecord_t *record) {}
+void taphold_stats_dump(void) {}
+void taphold_stats_task(void) {}
+
+#else
+
+// One slot per home-row position, allocated on first sight. Four base layers
+// share the same physical HRM positions, so 12 slots covers every board with
+// headroom.
+#define TH_STATS_SLOTS 12
+
+// 25ms histogram buckets: [0,25) [25,50) ... [175,inf)
+#define TH_HIST_BUCKETS 8
+#define TH_BUCKET_MS 25
+
+// Minimum spacing between dump lines (same policy as trace.c)
+#define TH_DUMP_INTERVAL_MS 5
+
+typedef struct {
+    uint8_t  row;
+    uint8_t  col;
+    uint16_t taps;
+    uint16_t holds;
+    uint16_t chordal;                 // chordal-hold overrides
+    uint16_t flow;                    // taps inside the flow-tap window
+    uint16_t interval_hist[TH_HIST_BUCKETS];
+} taphold_slot_t;
+
+static taphold_slot_t slots[TH_STATS_SLOTS];
+static uint8_t  slots_used      = 0;
+static uint16_t last_press_time = 0;
+static bool     has_press       = false;
+static uint8_t  dump_cursor     = 0xFF;  // 0xFF = idle
+static uint16_t last_dump_time  = 0;
+
+static taphold_slot_t *slot_for(keypos_t key) {
+    for (uint8_t i = 0; i < slots_used; i++) {
+        if (slots[i].row == key.row && slots[i].col == key.col) {
+            return &slots[i];
+        }
+    }
+    if (slots_used == TH_STATS_SLOTS) {
+        return NULL;
+    }
+    taphold_slot_t *slot = &slots[slots_used++];
+    slot->row            = key.row;
+    slot->col            = key.col;
+    return slot;
+}
+
+void taphold_stats_record(keyrecord_t *record, uint8_t resolution) {
+    taphold_slot_t *slot = slot_for(record->event.key);
+    if (slot == NULL) {
+        return;
+    }
+
+    // event.time is the actual press timestamp, unaffected by how long the
+    // tap-hold sat unsettled before process_record ran
+    const uint16_t interval = has_press ? (uint16_t)(record->event.time - last_press_time) : 0xFFFF;
+
+    switch (resolution) {
+        case TH_RESOLVED_TAP:
+            slot->taps++;
+            if (interval < FLOW_TAP_TERM) {
+                slot->flow++;
+            }
+            break;
+        case TH_RESOLVED_HOLD:
+            slot->holds++;
+            break;
+        case TH_CHORDAL_OVERRIDE:
+            slot->chordal++;
+            return;  // interval histogram only tracks settled events
+    }
+
+    uint8_t bucket = interval / TH_BUCKET_MS;
+    if (bucket >= TH_HIST_BUCKETS) {
+        bucket = TH_HIST_BUCKETS - 1;
+    }
+    slot->interval_hist[bucket]++;
+}
+
+void taphold_stats_note_press(keyrecord_t *record) {
+    last_press_time = record->event.time;
+    has_press       = true;
+}
+
+void taphold_stats_dump(void) {
+    dump_cursor = 0;
+}
+
+void taphold_stats_task(void) {
+    if (dump_cursor == 0xFF) {
+        return;
+    }
+    if (timer_elapsed(last_dump_time) < TH_DUMP_INTERVAL_MS) {
+        return;
+    }
+    last_dump_time = timer_read();
+
+    if (dump_cursor >= slots_used) {
+        uprintf("thstat end (%u positions)\n", slots_used);
+        dump_cursor = 0xFF;
+        return;
+    }
+
+    const taphold_slot_t *slot = &slots[dump_cursor++];
+    uprintf("thstat %u,%u tap=%u hold=%u chrd=%u flow=%u hist=%u,%u,%u,%u,%u,%u,%u,%u\n",
+            slot->row, slot->col, slot->taps, slot->holds, slot->chordal, slot->flow,
+            slot->interval_hist[0], slot->interval_hist[1], slot->interval_hist[2],
+            slot->interval_hist[3], slot->interval_hist[4], slot->interval_hist[5],
+            slot->interval_hist[6], slot->interval_hist[7]);
+}
+
+#endif  // CONSOLE_ENABLE
@@ -0,0 +1,35 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Per-position tap-hold resolution telemetry.
+//
+// TAPPING_TERM_HRM and FLOW_TAP_TERM were picked by folklore; this module
+// records, for each home-row mod position, how every settled event resolved
+// (tap/hold), how often the chordal-hold fast path overrode a would-be hold,
+// how many taps landed inside the flow-tap window, and a histogram of the
+// inter-key interval preceding the press (25ms buckets). The data lives in
+// RAM and drains to the console one line per scan when THSTAT_DUMP is hit,
+// so the distributions come from real typing rather than guesswork.
+//
+// Compiles to empty stubs when CONSOLE_ENABLE is off (AVR/V-USB boards),
+// where the dump channel doesn't exist and RAM is too tight anyway.
+
+enum taphold_resolution {
+    TH_RESOLVED_TAP,       // settled as tap (tap.count > 0)
+    TH_RESOLVED_HOLD,      // settled as hold
+    TH_CHORDAL_OVERRIDE,   // get_chordal_hold forced tap settlement
+};
+
+// Record a settled tap-hold event at a home-row position; the inter-key
+// interval is derived from record->event.time against the previous press
+void taphold_stats_record(keyrecord_t *record, uint8_t resolution);
+
+// Track press timestamps for interval measurement; call on every press
+void taphold_stats_note_press(keyrecord_t *record);
+
+// Begin draining stats to the console (bound to THSTAT_DUMP)
+void taphold_stats_dump(void);
+
+// Emit at most one dump line per call; called from housekeeping_task_user()
+void taphold_stats_task(void);
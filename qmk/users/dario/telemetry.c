@@ -0,0 +1,99 @@
+#include "telemetry.h"
+
+#ifndef RAW_ENABLE
+
+// Raw HID disabled: keep call sites (trace.c) linkable at zero cost
+void telemetry_log_event(uint8_t type, uint16_t a, uint16_t b) {}
+
+#else
+
+#include "raw_hid.h"
+#include "dario.h"
+#include "scan_perf.h"
+
+// Same sizing rationale as the console trace ring (trace.c): 16 packed
+// entries is enough to bridge poll intervals at typing speed on the
+// atmega32u4 boards without a noticeable RAM bill.
+#define TELEMETRY_BUFFER_SIZE 16
+#define TELEMETRY_BUFFER_MASK (TELEMETRY_BUFFER_SIZE - 1)
+
+// Events per 32-byte report: (32 - 10 header bytes) / 7 bytes per record
+#define TELEMETRY_EVENTS_PER_REPORT 3
+
+typedef struct {
+    uint16_t time;  // timer_read() at emit
+    uint8_t  type;  // trace_event_type
+    uint16_t a;
+    uint16_t b;
+} telemetry_event_t;
+
+static telemetry_event_t buffer[TELEMETRY_BUFFER_SIZE];
+static uint8_t buffer_head = 0;  // next event to send
+static uint8_t buffer_tail = 0;  // next free slot
+
+static uint8_t buffer_len(void) {
+    return (uint8_t)(buffer_tail - buffer_head) & TELEMETRY_BUFFER_MASK;
+}
+
+void telemetry_log_event(uint8_t type, uint16_t a, uint16_t b) {
+    if (buffer_len() == TELEMETRY_BUFFER_SIZE - 1) {
+        return;  // Drop newest; the host poll will drain the backlog
+    }
+    telemetry_event_t *event = &buffer[buffer_tail & TELEMETRY_BUFFER_MASK];
+    event->time = timer_read();
+    event->type = type;
+    event->a    = a;
+    event->b    = b;
+    buffer_tail++;
+}
+
+static void write_u16(uint8_t *out, uint16_t value) {
+    out[0] = (uint8_t)(value & 0xFF);
+    out[1] = (uint8_t)(value >> 8);
+}
+
+static void send_snapshot(void) {
+    uint8_t response[TELEMETRY_REPORT_SIZE] = {0};
+
+    scan_perf_stats_t stats = scan_perf_snapshot();
+    response[0] = TELEMETRY_MAGIC;
+    response[1] = TELEMETRY_VERSION;
+    write_u16(&response[2], stats.scans_per_sec);
+    write_u16(&response[4], stats.mean_scan_us);
+    response[6] = stats.p99_interval_ms;
+    response[7] = stats.max_interval_ms;
+    response[8] = get_current_base_layer();
+
+    uint8_t count = 0;
+    uint8_t offset = 10;
+    while (count < TELEMETRY_EVENTS_PER_REPORT && buffer_head != buffer_tail) {
+        const telemetry_event_t *event = &buffer[buffer_head & TELEMETRY_BUFFER_MASK];
+        response[offset] = event->type;
+        write_u16(&response[offset + 1], event->time);
+        write_u16(&response[offset + 3], event->a);
+        write_u16(&response[offset + 5], event->b);
+        buffer_head++;
+        offset += 7;
+        count++;
+    }
+    response[9] = count;
+
+    raw_hid_send(response, TELEMETRY_REPORT_SIZE);
+}
+
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length == 0) {
+        return;
+    }
+    switch (data[0]) {
+        case TELEMETRY_CMD_SNAPSHOT:
+            send_snapshot();
+            break;
+        default:
+            // Unknown command: stay silent so other raw HID users
+            // (e.g. configurators probing) are not confused by replies
+            break;
+    }
+}
+
+#endif  // RAW_ENABLE
@@ -0,0 +1,34 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Raw HID telemetry channel.
+//
+// The AVR/V-USB boards run with CONSOLE_ENABLE off (endpoint and flash
+// cost), which makes the most constrained boards the hardest to observe.
+// This module exposes the same signals over raw HID instead: the host polls
+// with a one-byte command and gets back a fixed 32-byte binary report with
+// the latest scan_perf window plus any buffered trace events. Nothing is
+// transmitted unless the host asks, so the idle cost is a small RAM ring.
+//
+// Decoded live by scripts/telemetry_dashboard.py.
+
+// Report layout (little-endian, TELEMETRY_REPORT_SIZE bytes):
+//   [0]     TELEMETRY_MAGIC
+//   [1]     protocol version
+//   [2:4]   scans_per_sec
+//   [4:6]   mean_scan_us
+//   [6]     p99 inter-scan interval (ms)
+//   [7]     max inter-scan interval (ms)
+//   [8]     current base layer
+//   [9]     event record count (0-3)
+//   [10:31] event records, 7 bytes each: type, time u16, a u16, b u16
+#define TELEMETRY_MAGIC        0xD7
+#define TELEMETRY_VERSION      1
+#define TELEMETRY_REPORT_SIZE  32
+#define TELEMETRY_CMD_SNAPSHOT 0x01
+
+// Record an event into the telemetry ring (cheap stores; dropped if full).
+// Fed by trace_emit(), so combo/magic instrumentation shows up on both the
+// console trace and the HID channel without duplicate call sites.
+void telemetry_log_event(uint8_t type, uint16_t a, uint16_t b);
@@ -0,0 +1,74 @@
+#include "trace.h"
+#include "telemetry.h"
+#include "print.h"
+
+// Ring buffer of packed events. 16 entries keeps RAM cost low enough for the
+// atmega32u4 boards; the drain keeps up at typing speed so overflow only
+// happens in bursts, which we count rather than block on.
+#define TRACE_BUFFER_SIZE 16
+#define TRACE_BUFFER_MASK (TRACE_BUFFER_SIZE - 1)
+
+// Minimum spacing between console writes so draining never stacks
+// multiple uprintf calls into one scan interval
+#define TRACE_DRAIN_INTERVAL_MS 5
+
+typedef struct {
+    uint16_t time;  // timer_read() at emit
+    uint8_t  type;  // trace_event_type
+    uint16_t a;
+    uint16_t b;
+} trace_event_t;
+
+static trace_event_t buffer[TRACE_BUFFER_SIZE];
+static uint8_t  buffer_head = 0;  // next event to drain
+static uint8_t  buffer_tail = 0;  // next free slot
+static bool     capture_enabled = false;
+static uint16_t dropped = 0;
+static uint16_t last_drain_time = 0;
+
+static uint8_t buffer_len(void) {
+    return (uint8_t)(buffer_tail - buffer_head) & TRACE_BUFFER_MASK;
+}
+
+void trace_emit(uint8_t type, uint16_t a, uint16_t b) {
+    // The raw HID channel gets every event regardless of the console
+    // capture toggle; its ring only drains when the host polls
+    telemetry_log_event(type, a, b);
+
+    if (!capture_enabled) {
+        return;
+    }
+    if (buffer_len() == TRACE_BUFFER_SIZE - 1) {
+        dropped++;
+        return;
+    }
+    trace_event_t *event = &buffer[buffer_tail & TRACE_BUFFER_MASK];
+    event->time = timer_read();
+    event->type = type;
+    event->a    = a;
+    event->b    = b;
+    buffer_tail++;
+}
+
+void trace_toggle(void) {
+    capture_enabled = !capture_enabled;
+    uprintf("trace %s\n", capture_enabled ? "on" : "off");
+    if (!capture_enabled && dropped > 0) {
+        uprintf("trace dropped=%u\n", dropped);
+        dropped = 0;
+    }
+}
+
+void trace_task(void) {
+    if (buffer_head == buffer_tail) {
+        return;
+    }
+    if (timer_elapsed(last_drain_time) < TRACE_DRAIN_INTERVAL_MS) {
+        return;
+    }
+    last_drain_time = timer_read();
+
+    const trace_event_t *event = &buffer[buffer_head & TRACE_BUFFER_MASK];
+    uprintf("trc %u t=%u a=%u b=%u\n", event->type, event->time, event->a, event->b);
+    buffer_head++;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Binary event trace buffer for combo/magic timing debugging.
+//
+// The previous approach logged with uprintf directly from
+// process_record_user(), paying console-write cost on every keystroke.
+// trace_emit() instead does a few cheap stores into a fixed-size ring
+// buffer (and nothing at all while tracing is off); events are drained
+// to the console at a rate-limited pace from housekeeping_task_user().
+// Capture is toggled at runtime with the TRACE_TOGG keycode (MEDIA layer).
+
+enum trace_event_type {
+    TRACE_COMBO_KEY,      // a=keycode, b=(row<<8)|col
+    TRACE_COMBO_EVENT,    // a=combo_index, b=(layer<<8)|pressed
+    TRACE_AREP_TRIGGER,   // a=raw keycode, b=tap keycode
+    TRACE_AREP_RESOLVE,   // a=last key, b=alt keycode
+    TRACE_AREP_REPEAT,    // a=last key, b=last mods
+    TRACE_AREP_MODTAP,    // a=raw keycode, b=(tap.count<<8)|interrupted
+    TRACE_TRAIN_CHECK,    // a=last key, b=alt keycode
+    TRACE_TRAIN_BLOCK,    // a=expected keycode, b=pressed keycode
+    TRACE_REMEMBER,       // a=tap keycode, b=remembered mods
+    TRACE_REMEMBER_SKIP,  // a=tap keycode, b=raw keycode
+    TRACE_REP,            // a=last key, b=last mods
+    TRACE_BOOT_FIRST_KEY, // a=ms from reset (clamped), b=scan count at first key
+};
+
+// Record an event (cheap stores; no-op while tracing is disabled)
+void trace_emit(uint8_t type, uint16_t a, uint16_t b);
+
+// Runtime capture toggle (bound to TRACE_TOGG)
+void trace_toggle(void);
+
+// Drain buffered events to the console; called from housekeeping_task_user()
+void trace_task(void);
@@ -0,0 +1,48 @@
+#include "wpm_lite.h"
+
+#ifndef WPM_LITE_ENABLE
+
+// Keep call sites linkable at zero cost on boards without a display
+void wpm_lite_count_keystroke(void) {}
+void wpm_lite_task(void) {}
+uint8_t wpm_lite_get(void) { return 0; }
+
+#else
+
+#define WPM_LITE_WINDOW_MS 1000
+#define WPM_LITE_MAX 400  // clamp before the x16 average to dodge overflow
+
+static uint16_t keystrokes = 0;      // presses since the window opened
+static uint32_t window_start = 0;
+static uint16_t smoothed_x16 = 0;    // moving average, x16 fixed point
+
+void wpm_lite_count_keystroke(void) {
+    keystrokes++;
+}
+
+void wpm_lite_task(void) {
+    const uint32_t now = timer_read32();
+    const uint32_t elapsed = now - window_start;
+    if (elapsed < WPM_LITE_WINDOW_MS) {
+        return;
+    }
+
+    // chars/min / 5 chars-per-word = keystrokes * 12000 / elapsed_ms
+    uint16_t inst = (uint16_t)((uint32_t)keystrokes * 12000 / elapsed);
+    if (inst > WPM_LITE_MAX) {
+        inst = WPM_LITE_MAX;
+    }
+    keystrokes = 0;
+    window_start = now;
+
+    // EMA with alpha = 1/4: new = old + (inst - old) / 4, all in x16 units.
+    // An idle second feeds inst = 0, so the readout decays like stock WPM.
+    smoothed_x16 += ((int16_t)(inst << 4) - (int16_t)smoothed_x16) >> 2;
+}
+
+uint8_t wpm_lite_get(void) {
+    const uint16_t wpm = smoothed_x16 >> 4;
+    return (wpm > 255) ? 255 : (uint8_t)wpm;
+}
+
+#endif  // WPM_LITE_ENABLE
@@ -0,0 +1,25 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Fixed-point WPM estimator replacing QMK's stock WPM on the OLED boards.
+//
+// The stock implementation does per-keystroke and per-scan bookkeeping; here
+// the hot path is a single counter increment from process_record_user(), and
+// a housekeeping task closes a 1s window, converts the count to words/min
+// (5 chars per word, same convention as stock) and folds it into a x16
+// fixed-point moving average with shift arithmetic. The display reads the
+// smoothed value at its own pace, which pairs with the dirty-line OLED
+// renderer: an unchanged WPM costs one compare per frame.
+//
+// Enabled per board with WPM_LITE_ENABLE (OPT_DEFS in qmk/config/boards/);
+// otherwise the stubs compile away.
+
+// One add; called from process_record_user() on every press
+void wpm_lite_count_keystroke(void);
+
+// Close the 1s window and decay the average; called from housekeeping_task_user()
+void wpm_lite_task(void);
+
+// Smoothed words-per-minute for the OLED (clamped to 255)
+uint8_t wpm_lite_get(void);
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""
+Firmware artifact manifest
+
+Walks the firmware output directories (out/qmk, out/zmk), hashes every
+artifact, and writes out/manifest.json:
+
+    {
+      "version": 1,
+      "generated": "2026-08-27T12:34:56+00:00",
+      "config_digest": "<sha256 over config/*.yaml>",
+      "artifacts": {
+        "qmk/jels_boaty_dario.hex": {"sha256": "...", "size": 28514},
+        ...
+      }
+    }
+
+build_all.sh runs this after the builds finish; because out/ is no longer
+wiped between runs, diffing against the previous manifest shows exactly
+which images actually changed. flash_boaty.sh uses the same content hash
+to skip flashing an image identical to the last one flashed.
+
+Run directly to (re)generate the manifest and print a changed/unchanged
+summary against the previous one.
+"""
+
+import argparse
+import hashlib
+import json
+import sys
+from datetime import datetime, timezone
+from pathlib import Path
+
+MANIFEST_VERSION = 1
+
+# Directories under out/ that hold flashable firmware, and the extensions
+# that count as artifacts (logs and visualizations are deliberately excluded)
+FIRMWARE_DIRS = ["qmk", "zmk"]
+FIRMWARE_EXTENSIONS = {".hex", ".uf2", ".bin"}
+
+
+def _sha256(path: Path) -> str:
+    """SHA-256 of a file's contents"""
+    return hashlib.sha256(path.read_bytes()).hexdigest()
+
+
+def config_digest(repo_root: Path) -> str:
+    """
+    Digest of the source configuration the artifacts were built from
+    (top-level config YAMLs plus the row-stagger layouts), so the manifest
+    records which config state a given set of images corresponds to.
+    """
+    hasher = hashlib.sha256()
+    inputs = sorted((repo_root / "config").glob("*.yaml"))
+    inputs += sorted((repo_root / "config" / "rowstagger").glob("*.yaml"))
+    for path in inputs:
+        hasher.update(str(path.relative_to(repo_root)).encode())
+        hasher.update(_sha256(path).encode())
+    return hasher.hexdigest()
+
+
+def build_manifest(repo_root: Path) -> dict:
+    """Scan the firmware output directories and build the manifest dict"""
+    out_dir = repo_root / "out"
+    artifacts = {}
+    for sub in FIRMWARE_DIRS:
+        sub_dir = out_dir / sub
+        if not sub_dir.is_dir():
+            continue
+        for path in sorted(sub_dir.iterdir()):
+            if path.is_file() and path.suffix in FIRMWARE_EXTENSIONS:
+                artifacts[f"{sub}/{path.name}"] = {
+                    "sha256": _sha256(path),
+                    "size": path.stat().st_size,
+                }
+    return {
+        "version": MANIFEST_VERSION,
+        "generated": datetime.now(timezone.utc).isoformat(timespec="seconds"),
+        "config_digest": config_digest(repo_root),
+        "artifacts": artifacts,
+    }
+
+
+def load_manifest(manifest_path: Path) -> dict:
+    """Load a previous manifest; a missing or corrupt one is treated as empty"""
+    try:
+        data = json.loads(manifest_path.read_text())
+        if data.get("version") == MANIFEST_VERSION:
+            return data
+    except (json.JSONDecodeError, OSError):
+        pass
+    return {"artifacts": {}}
+
+
+def write_manifest(repo_root: Path) -> dict:
+    """
+    Generate out/manifest.json and print a changed/unchanged summary
+    against the previous manifest. Returns the new manifest.
+    """
+    manifest_path = repo_root / "out" / "manifest.json"
+    previous = load_manifest(manifest_path).get("artifacts", {})
+    manifest = build_manifest(repo_root)
+
+    manifest_path.parent.mkdir(parents=True, exist_ok=True)
+    manifest_path.write_text(json.dumps(manifest, indent=2, sort_keys=True) + "\n")
+
+    changed = unchanged = 0
+    for name, entry in manifest["artifacts"].items():
+        prev = previous.get(name)
+        if prev and prev.get("sha256") == entry["sha256"]:
+            unchanged += 1
+            print(f"  = {name} (unchanged)")
+        else:
+            changed += 1
+            status = "changed" if prev else "new"
+            print(f"  + {name} ({status}, {entry['size']} bytes)")
+    removed = sorted(set(previous) - set(manifest["artifacts"]))
+    for name in removed:
+        print(f"  - {name} (removed)")
+
+    if not manifest["artifacts"]:
+        print("  (no firmware artifacts found in out/)")
+    print(f"✅ Manifest written: {manifest_path} "
+          f"({changed} changed, {unchanged} unchanged)")
+    return manifest
+
+
+def artifact_hash(repo_root: Path, relative_name: str) -> str:
+    """
+    Print the manifest hash for one artifact (e.g. "qmk/jels_boaty_dario.hex"),
+    for shell callers like flash_boaty.sh. Falls back to hashing the file
+    directly when the manifest is missing or stale.
+    """
+    manifest = load_manifest(repo_root / "out" / "manifest.json")
+    entry = manifest.get("artifacts", {}).get(relative_name)
+    path = repo_root / "out" / relative_name
+    if entry and path.exists() and path.stat().st_size == entry["size"]:
+        return entry["sha256"]
+    if not path.exists():
+        raise FileNotFoundError(f"Artifact not found: {path}")
+    return _sha256(path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate out/manifest.json")
+    parser.add_argument("--hash", metavar="ARTIFACT",
+                        help="Print the content hash of one artifact "
+                             "(path relative to out/) and exit")
+    args = parser.parse_args()
+
+    repo_root = Path(__file__).parent.parent
+    if args.hash:
+        try:
+            print(artifact_hash(repo_root, args.hash))
+        except FileNotFoundError as e:
+            print(e, file=sys.stderr)
+            sys.exit(1)
+        return
+    write_manifest(repo_root)
+
+
+if __name__ == "__main__":
+    main()
@@ -199,7 +199,10 @@ class YAMLConfigParser:
                 firmware=board_data['firmware'],
                 layout_size=board_data.get('layout_size', '3x5_3'),
                 extra_layers=board_data.get('extra_layers', []),
+                base_layers=board_data.get('base_layers'),  # Reachable BASE_* allowlist
                 keymap_file=board_data.get('keymap_file'),  # Board-specific keymap file
+                compress_keymap=board_data.get('compress_keymap', False),
+                sleep_timeout_s=board_data.get('sleep_timeout_s'),  # Idle quiet period (seconds)
                 qmk_keyboard=board_data.get('qmk_keyboard'),
                 zmk_shield=board_data.get('zmk_shield'),
                 zmk_board=board_data.get('zmk_board')
@@ -333,6 +336,30 @@ class YAMLConfigParser:
 
         return config
 
+    @staticmethod
+    def parse_handedness(yaml_path: Path):
+        """
+        Parse the optional chordal_hold_handedness table from a board keymap file
+
+        Boards with custom physical layouts (e.g. the boaty monoblock) declare
+        an explicit per-key handedness list ('L'/'R'/'*') alongside their
+        full_layout. Returns None when the file has no table, so standard
+        layouts fall back to arithmetic derivation in the generator.
+
+        Args:
+            yaml_path: Path to the board keymap file (e.g. config/boaty.yaml)
+
+        Returns:
+            List of one-character handedness strings, or None if absent
+        """
+        with open(yaml_path, 'r') as f:
+            data = yaml.safe_load(f)
+
+        if not data or 'chordal_hold_handedness' not in data:
+            return None
+
+        return [str(h) for h in data['chordal_hold_handedness']]
+
     @staticmethod
     def parse_combos(yaml_path: Path) -> ComboConfiguration:
         """
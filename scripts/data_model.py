@@ -201,7 +201,14 @@ class Board:
     - firmware: Target firmware ("qmk" or "zmk")
     - layout_size: Physical layout size (e.g., "3x5_3", "3x6_3", "custom_58")
     - extra_layers: Board-specific additional layers (e.g., ["GAME"])
+    - base_layers: Optional allowlist of BASE_* layers this board actually uses;
+                   layers (and their magic macros) outside the list are pruned
+                   from the generated code (None = keep everything)
     - keymap_file: Optional board-specific keymap file (e.g., "boaty.yaml")
+    - compress_keymap: Emit dictionary-compressed keymap storage (QMK, flash-constrained boards)
+    - sleep_timeout_s: Optional idle quiet period in seconds; projected into the
+                       board's firmware config (QMK .mk defines / ZMK .conf
+                       sleep settings) by the generator (None = no idle mode)
     - qmk_keyboard: QMK keyboard path (required for QMK boards)
     - zmk_shield: ZMK shield name (required for ZMK boards)
     """
@@ -210,7 +217,10 @@ class Board:
     firmware: Literal["qmk", "zmk"]
     layout_size: str = "3x5_3"  # Default to 36-key
     extra_layers: List[str] = field(default_factory=list)
+    base_layers: Optional[List[str]] = None  # Allowlist of reachable BASE_* layers (None = all)
     keymap_file: Optional[str] = None  # Board-specific keymap file (e.g., "boaty.yaml")
+    compress_keymap: bool = False  # Dictionary-compressed keymap storage (AVR flash headroom)
+    sleep_timeout_s: Optional[int] = None  # Idle quiet period before low-power mode (None = disabled)
 
     # Firmware-specific fields
     qmk_keyboard: Optional[str] = None
@@ -234,6 +244,19 @@ class Board:
             raise ValidationError(f"Board {self.id}: qmk_keyboard required for QMK firmware")
         if self.firmware == "zmk" and not self.zmk_shield and not self.zmk_board:
             raise ValidationError(f"Board {self.id}: either zmk_shield or zmk_board required for ZMK firmware")
+        if self.base_layers is not None:
+            if not self.base_layers:
+                raise ValidationError(f"Board {self.id}: base_layers allowlist cannot be empty")
+            for name in self.base_layers:
+                if not name.startswith("BASE_"):
+                    raise ValidationError(
+                        f"Board {self.id}: base_layers entry '{name}' must be a BASE_* layer"
+                    )
+        if self.sleep_timeout_s is not None:
+            if not isinstance(self.sleep_timeout_s, int) or self.sleep_timeout_s <= 0:
+                raise ValidationError(
+                    f"Board {self.id}: sleep_timeout_s must be a positive integer (seconds)"
+                )
 
     def get_output_directory(self) -> str:
         """Get the output directory for generated keymaps"""
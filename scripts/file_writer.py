@@ -46,20 +46,34 @@ class FileSystemWriter:
             shutil.rmtree(dir_path)
 
     @staticmethod
-    def write_all(output_dir: Path, files: Dict[str, str]) -> None:
+    def write_all(output_dir: Path, files: Dict[str, str]) -> int:
         """
         Write multiple files to a directory
 
-        Cleans the output directory first to ensure no stale files remain.
+        Files whose on-disk content already matches are left untouched so
+        their mtimes don't move (qmk compile rebuilds on mtime, so rewriting
+        identical output forces needless firmware rebuilds). Stale files not
+        in the generated set are removed.
 
         Args:
             output_dir: Output directory path
             files: Dictionary of {filename: content}
+
+        Returns:
+            Number of files actually written (created or changed)
         """
-        # Clean output directory first to remove any stale generated files
-        FileSystemWriter.clean_directory(output_dir)
         FileSystemWriter.ensure_directory(output_dir)
 
+        # Remove stale generated files from previous runs
+        for existing in output_dir.iterdir():
+            if existing.is_file() and existing.name not in files:
+                existing.unlink()
+
+        written = 0
         for filename, content in files.items():
             file_path = output_dir / filename
+            if file_path.exists() and file_path.read_text() == content:
+                continue
             FileSystemWriter.write_file(file_path, content)
+            written += 1
+        return written
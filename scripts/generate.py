@@ -37,16 +37,27 @@ from layer_compiler import LayerCompiler
 from qmk_generator import QMKGenerator
 from zmk_generator import ZMKGenerator
 from file_writer import FileSystemWriter
+from generation_cache import GenerationCache
 from validator import ConfigValidator
-from visualizer import KeymapVisualizer
-from keylayout_translator import KeylayoutTranslator
-from keylayout_generator import KeylayoutGenerator
+# KeymapVisualizer and the keylayout modules are imported lazily at their call
+# sites: they drag in SVG/PDF libraries that the validate/check paths and the
+# common regenerate loop do not need at startup
+
+
+# Markers for the generator-owned idle/sleep block inside the otherwise
+# manually-maintained per-board firmware config files
+IDLE_SLEEP_BLOCK_BEGIN = "# --- BEGIN GENERATED: idle sleep (sleep_timeout_s in config/boards.yaml) ---"
+IDLE_SLEEP_BLOCK_END = "# --- END GENERATED: idle sleep ---"
+
+# Markers for the key position tables maintained in zmk/config/dario_behaviors.dtsi
+ZMK_POSITIONS_BLOCK_BEGIN = "/* --- BEGIN GENERATED: key position tables (canonical 36-key scheme) --- */"
+ZMK_POSITIONS_BLOCK_END = "/* --- END GENERATED: key position tables --- */"
 
 
 class KeymapGenerator:
     """Main generator orchestrator"""
 
-    def __init__(self, repo_root: Path, verbose: bool = False, magic_training: bool = True):
+    def __init__(self, repo_root: Path, verbose: bool = False, magic_training: bool = True, force: bool = False):
         """
         Initialize generator
 
@@ -54,11 +65,14 @@ class KeymapGenerator:
             repo_root: Repository root directory
             verbose: Enable verbose output
             magic_training: Enable magic-key training mode (punish direct bigrams)
+            force: Regenerate all boards even when the cache says inputs are unchanged
         """
         self.repo_root = repo_root
         self.config_dir = repo_root / "config"
         self.verbose = verbose
         self.magic_training = magic_training
+        self.force = force
+        self.cache = GenerationCache(repo_root)
 
         # Parse configuration
         self._log("📖 Parsing configuration...")
@@ -105,6 +119,12 @@ class KeymapGenerator:
         validator = ConfigValidator()
         validator.validate_keymap_config(self.keymap_config.layers)
         validator.validate_board_config(list(self.board_inventory.boards.values()))
+        validator.validate_cross_references(
+            self.keymap_config.layers,
+            list(self.board_inventory.boards.values()),
+            combos=self.combos,
+            magic_config=self.magic_config,
+        )
         self._log("✅ Configuration is valid")
 
         # Initialize translators
@@ -142,6 +162,13 @@ class KeymapGenerator:
             print(f"❌ Board '{board_id}' not found in config/boards.yaml")
             return False
 
+        # Skip boards whose inputs (YAMLs, templates, generator sources)
+        # are unchanged since the last successful run
+        input_digest = self.cache.board_input_digest(board)
+        if not self.force and self.cache.is_fresh(board, input_digest):
+            self._log(f"\n⏭️  {board.name} is up to date (inputs unchanged)")
+            return True
+
         self._log(f"\n🔨 Generating keymap for {board.name}...")
 
         if self.verbose:
@@ -155,6 +182,7 @@ class KeymapGenerator:
 
         # Load keymap with board-specific overlay if specified
         keymap_config = self.keymap_config
+        handedness_override = None
         if board.keymap_file:
             overlay_path = self.config_dir / board.keymap_file
             if overlay_path.exists():
@@ -163,6 +191,7 @@ class KeymapGenerator:
                     self.config_dir / "keymap.yaml",
                     overlay_path
                 )
+                handedness_override = YAMLConfigParser.parse_handedness(overlay_path)
             else:
                 print(f"⚠️  Warning: Board specifies keymap_file '{board.keymap_file}' but file not found")
 
@@ -190,14 +219,23 @@ class KeymapGenerator:
 
             # Generate files based on firmware
             if board.firmware == "qmk":
-                self._generate_qmk(board, compiled_layers)
+                self._generate_qmk(board, compiled_layers, handedness_override)
             elif board.firmware == "zmk":
                 self._generate_zmk(board, compiled_layers)
             else:
                 print(f"❌ Unknown firmware: {board.firmware}")
                 return False
 
+            # Keep the board's firmware config in step with the idle knob
+            self._sync_idle_sleep_config(board)
+
+            # Keep the shared ZMK behavior file's position tables in step
+            # with the canonical 36-key scheme
+            if board.firmware == "zmk":
+                self._sync_zmk_position_tables(board)
+
             print(f"✅ Generated keymap for {board.name}")
+            self.cache.update(board, input_digest)
             return True
 
         except ValidationError as e:
@@ -209,17 +247,18 @@ class KeymapGenerator:
             traceback.print_exc()
             return False
 
-    def _generate_qmk(self, board, compiled_layers):
+    def _generate_qmk(self, board, compiled_layers, handedness_override=None):
         """Generate QMK keymap files"""
         generator = QMKGenerator()
         output_dir = self.repo_root / board.get_output_directory()
 
         # Generate all files (combos and magic keys are now inline in keymap.c)
-        files = generator.generate_keymap(board, compiled_layers, output_dir, self.combos, self.magic_config)
+        files = generator.generate_keymap(board, compiled_layers, output_dir, self.combos,
+                                          self.magic_config, handedness_override)
 
-        # Write keymap files
-        FileSystemWriter.write_all(output_dir, files)
-        print(f"  📝 Wrote {len(files)} files to {output_dir}")
+        # Write keymap files (identical files are left untouched to preserve mtimes)
+        written = FileSystemWriter.write_all(output_dir, files)
+        print(f"  📝 Wrote {written}/{len(files)} files to {output_dir}")
 
     def _generate_zmk(self, board, compiled_layers):
         """Generate ZMK keymap files"""
@@ -252,10 +291,115 @@ class KeymapGenerator:
             "README.md": readme_content,
         }
 
-        # Write files
-        FileSystemWriter.write_all(output_dir, files)
+        # Write files (identical files are left untouched to preserve mtimes)
+        written = FileSystemWriter.write_all(output_dir, files)
+
+        print(f"  📝 Wrote {written}/{len(files)} files to {output_dir}")
+
+    def _sync_idle_sleep_config(self, board):
+        """
+        Project sleep_timeout_s into the board's firmware config file
+
+        Maintains a marked block in the manually-edited per-board config
+        (qmk/config/boards/<id>.mk or zmk/config/boards/<id>.conf) so one
+        knob in config/boards.yaml drives both firmwares. Everything outside
+        the markers is left untouched; removing the knob removes the block.
+        """
+        if board.firmware == "qmk":
+            path = self.repo_root / "qmk" / "config" / "boards" / f"{board.id}.mk"
+            settings = [
+                "OPT_DEFS += -DIDLE_SLEEP_ENABLE",
+                f"OPT_DEFS += -DIDLE_SLEEP_TIMEOUT_MS={board.sleep_timeout_s * 1000 if board.sleep_timeout_s else 0}UL",
+            ]
+        else:  # zmk
+            path = self.repo_root / "zmk" / "config" / "boards" / f"{board.id}.conf"
+            settings = [
+                "CONFIG_ZMK_SLEEP=y",
+                f"CONFIG_ZMK_IDLE_SLEEP_TIMEOUT={board.sleep_timeout_s * 1000 if board.sleep_timeout_s else 0}",
+            ]
+
+        if not path.exists():
+            if board.sleep_timeout_s is not None:
+                print(f"⚠️  Warning: sleep_timeout_s set for {board.id} but {path} does not exist")
+            return
+
+        content = path.read_text()
+        lines = content.splitlines()
+
+        # Drop the existing managed block (if any), remembering where it was
+        insert_at = None
+        if IDLE_SLEEP_BLOCK_BEGIN in lines and IDLE_SLEEP_BLOCK_END in lines:
+            insert_at = lines.index(IDLE_SLEEP_BLOCK_BEGIN)
+            del lines[insert_at:lines.index(IDLE_SLEEP_BLOCK_END) + 1]
+
+        if board.sleep_timeout_s is not None:
+            block = [
+                IDLE_SLEEP_BLOCK_BEGIN,
+                "# Do not edit by hand; regenerate with scripts/generate.py",
+                *settings,
+                IDLE_SLEEP_BLOCK_END,
+            ]
+            if insert_at is not None:
+                lines[insert_at:insert_at] = block
+            else:
+                if lines and lines[-1].strip():
+                    lines.append("")
+                lines.extend(block)
 
-        print(f"  📝 Wrote {len(files)} files to {output_dir}")
+        new_content = "\n".join(lines).rstrip("\n") + "\n"
+        if new_content != content:
+            path.write_text(new_content)
+            print(f"  🔧 Synced idle sleep settings in {path.relative_to(self.repo_root)}")
+
+    def _sync_zmk_position_tables(self, board):
+        """
+        Project the canonical 36-key hand/thumb position tables into
+        zmk/config/dario_behaviors.dtsi
+
+        Maintains a marked block of #define lines (POS_LEFT_HAND,
+        POS_RIGHT_HAND, POS_LEFT_THUMBS, POS_RIGHT_THUMBS) that the manually
+        written hml/hmr behaviors and the generated training hold-taps use for
+        hold-trigger-key-positions, so a layout change can't leave the
+        wireless boards with stale hand-written position math. Everything
+        outside the markers is left untouched.
+        """
+        if board.layout_size not in ("3x5_3", "3x6_3"):
+            return
+
+        path = self.repo_root / "zmk" / "config" / "dario_behaviors.dtsi"
+        if not path.exists():
+            return
+
+        generator = ZMKGenerator(special_keycodes=self.special_keycodes)
+        block = [
+            ZMK_POSITIONS_BLOCK_BEGIN,
+            "/* Do not edit by hand; regenerate with scripts/generate.py */",
+            *generator.generate_position_defines(board.layout_size),
+            ZMK_POSITIONS_BLOCK_END,
+        ]
+
+        content = path.read_text()
+        lines = content.splitlines()
+
+        if ZMK_POSITIONS_BLOCK_BEGIN in lines and ZMK_POSITIONS_BLOCK_END in lines:
+            insert_at = lines.index(ZMK_POSITIONS_BLOCK_BEGIN)
+            del lines[insert_at:lines.index(ZMK_POSITIONS_BLOCK_END) + 1]
+        else:
+            # First insertion: place the defines before the first devicetree
+            # statement so they are in scope for the behavior nodes below
+            insert_at = next(
+                (i for i, line in enumerate(lines)
+                 if line.strip() and not line.lstrip().startswith(("/*", "*", "//"))),
+                len(lines),
+            )
+            block = block + [""]
+
+        lines[insert_at:insert_at] = block
+
+        new_content = "\n".join(lines).rstrip("\n") + "\n"
+        if new_content != content:
+            path.write_text(new_content)
+            print(f"  🔧 Synced position tables in {path.relative_to(self.repo_root)}")
 
     def _generate_rowstagger_keylayouts(self):
         """Generate macOS .keylayout files for row-staggered keyboards"""
@@ -274,6 +418,8 @@ class KeymapGenerator:
         self._log(f"  Found {len(yaml_files)} layout(s)")
 
         # Initialize translator and generator
+        from keylayout_translator import KeylayoutTranslator
+        from keylayout_generator import KeylayoutGenerator
         translator = KeylayoutTranslator()
         template_path = self.repo_root / "scripts" / "templates" / "rowstagger_base.keylayout"
 
@@ -325,47 +471,17 @@ class KeymapGenerator:
         """
         success_count = 0
         failure_count = 0
-        compiled_layers_by_board = {}  # Store compiled layers for visualization
 
         for board_id in self.board_inventory.boards.keys():
-            board = self.board_inventory.boards[board_id]
-
-            # Load keymap with board-specific overlay if specified
-            keymap_config = self.keymap_config
-            if board.keymap_file:
-                overlay_path = self.config_dir / board.keymap_file
-                if overlay_path.exists():
-                    keymap_config = YAMLConfigParser.parse_keymap(
-                        self.config_dir / "keymap.yaml",
-                        overlay_path
-                    )
-
-            # Compile layers for this board
-            compiled_layers = []
-            for layer in keymap_config.layers.values():
-                # Check if this is a board-specific layer
-                # If the layer has full_layout:
-                # - For boards with keymap_file (custom layouts): include all full_layout layers
-                # - For other boards: only include if in extra_layers (like GAME)
-                if layer.full_layout is not None:
-                    if not board.keymap_file and layer.name not in board.extra_layers:
-                        # Skip if board doesn't use board-specific keymap and doesn't explicitly request this layer
-                        continue
-
-                compiled_layer = self.compiler.compile_layer(
-                    layer, board, board.firmware
-                )
-                compiled_layers.append(compiled_layer)
-
-            # Store for visualization
-            compiled_layers_by_board[board_id] = compiled_layers
-
-            # Generate keymap files
+            # generate_for_board handles overlay loading, layer compilation,
+            # and the incremental cache check
             if self.generate_for_board(board_id):
                 success_count += 1
             else:
                 failure_count += 1
 
+        self.cache.save()
+
         print(f"\n{'='*60}")
         print(f"✅ Successfully generated: {success_count} boards")
         if failure_count > 0:
@@ -387,17 +503,50 @@ class KeymapGenerator:
             print(f"⚠️  Warning: Failed to update .keymap-drawer-config.yaml: {e}")
 
         # Generate visualizations (grouped by base layer)
+        from visualizer import KeymapVisualizer
         visualizer = KeymapVisualizer(self.repo_root, self.qmk_translator)
 
         if visualizer.is_available():
-            visualizer.generate_superset_visualizations(self.board_inventory)
+            visualizer.generate_superset_visualizations(self.board_inventory, cache=self.cache)
             visualizer.generate_rowstagger_visualizations()
+            self.cache.save()  # persist the per-base-layer viz digests
         else:
             print(f"⚠️  keymap-drawer not available, skipping visualization")
 
         return 0 if failure_count == 0 else 1
 
 
+def check_only(repo_root: Path) -> int:
+    """
+    Fast pre-flight validation: parse the YAMLs and run structural plus
+    cross-reference checks, nothing else. No translators, no compiler, no
+    cache — cheap enough to bind to an editor save hook.
+    """
+    import time
+    start = time.monotonic()
+    config_dir = repo_root / "config"
+    try:
+        keymap_config = YAMLConfigParser.parse_keymap(config_dir / "keymap.yaml")
+        board_inventory = YAMLConfigParser.parse_boards(config_dir / "boards.yaml")
+        combos = YAMLConfigParser.parse_combos(config_dir / "keymap.yaml")
+        magic_config = YAMLConfigParser.parse_magic_keys(config_dir / "keymap.yaml")
+
+        validator = ConfigValidator()
+        boards = list(board_inventory.boards.values())
+        validator.validate_keymap_config(keymap_config.layers)
+        validator.validate_board_config(boards)
+        validator.validate_cross_references(
+            keymap_config.layers, boards, combos=combos, magic_config=magic_config
+        )
+    except (ValidationError, FileNotFoundError) as e:
+        print(f"❌ {e}")
+        return 1
+
+    elapsed_ms = (time.monotonic() - start) * 1000
+    print(f"✅ Configuration is valid ({elapsed_ms:.0f}ms)")
+    return 0
+
+
 def main():
     """Main entry point"""
     parser = argparse.ArgumentParser(
@@ -414,11 +563,22 @@ def main():
         dest="validate_only",
         help="Validate configuration without generating files"
     )
+    parser.add_argument(
+        "--check-only",
+        action="store_true",
+        help="Fast pre-flight check: parse and validate the YAMLs only, "
+             "skipping translator/compiler setup (editor save-hook friendly)"
+    )
     parser.add_argument(
         "-v", "--verbose",
         action="store_true",
         help="Enable verbose output (detailed progress information)"
     )
+    parser.add_argument(
+        "-f", "--force",
+        action="store_true",
+        help="Regenerate all boards, ignoring the incremental generation cache"
+    )
     parser.add_argument(
         "--no-magic-training",
         action="store_true",
@@ -430,12 +590,16 @@ def main():
     # Determine repository root
     repo_root = Path(__file__).parent.parent
 
+    if args.check_only:
+        return check_only(repo_root)
+
     try:
         # Initialize generator (this validates configuration)
         generator = KeymapGenerator(
             repo_root,
             verbose=args.verbose,
-            magic_training=not args.no_magic_training
+            magic_training=not args.no_magic_training,
+            force=args.force
         )
 
         if args.validate_only:
@@ -445,6 +609,8 @@ def main():
         # Generate keymaps
         if args.board:
             success = generator.generate_for_board(args.board)
+            if success:
+                generator.cache.save()
             return 0 if success else 1
         else:
             return generator.generate_all()
@@ -0,0 +1,119 @@
+"""
+Incremental generation cache
+
+Tracks a content hash of every input that feeds a board's generated output
+(the YAML configuration files, the generator templates, and the generator
+module sources themselves). When nothing a board depends on has changed
+since the last run, its generation step can be skipped entirely.
+
+The cache lives in .generation_cache.json at the repository root and is
+safe to delete at any time — the next run simply regenerates everything.
+"""
+
+import hashlib
+import json
+from pathlib import Path
+from typing import Dict, Optional
+
+
+# Bump when the cache entry format changes; a mismatch discards the cache
+CACHE_VERSION = 1
+
+
+class GenerationCache:
+    """Content-hash cache keyed by board id"""
+
+    def __init__(self, repo_root: Path):
+        self.repo_root = repo_root
+        self.cache_path = repo_root / ".generation_cache.json"
+        self.entries: Dict[str, str] = {}
+        self.viz_entries: Dict[str, str] = {}
+        self._digest_memo: Dict[Path, str] = {}
+        self._global_digest: Optional[str] = None
+        self._load()
+
+    def _load(self) -> None:
+        """Load cache entries from disk; a corrupt or stale cache is discarded"""
+        if not self.cache_path.exists():
+            return
+        try:
+            data = json.loads(self.cache_path.read_text())
+            if data.get("version") == CACHE_VERSION:
+                self.entries = data.get("boards", {})
+                self.viz_entries = data.get("viz", {})
+        except (json.JSONDecodeError, OSError):
+            self.entries = {}
+
+    def save(self) -> None:
+        """Persist cache entries to disk"""
+        data = {"version": CACHE_VERSION, "boards": self.entries, "viz": self.viz_entries}
+        self.cache_path.write_text(json.dumps(data, indent=2, sort_keys=True) + "\n")
+
+    def _file_digest(self, path: Path) -> str:
+        """SHA-256 of a file's contents (memoized per run)"""
+        if path not in self._digest_memo:
+            if path.exists():
+                self._digest_memo[path] = hashlib.sha256(path.read_bytes()).hexdigest()
+            else:
+                self._digest_memo[path] = "missing"
+        return self._digest_memo[path]
+
+    def _shared_input_digest(self) -> str:
+        """
+        Digest of the inputs every board depends on: the top-level config
+        YAMLs, the generator templates, and the generator sources (so a
+        generator change invalidates all boards, acting as a version stamp).
+        """
+        if self._global_digest is not None:
+            return self._global_digest
+
+        hasher = hashlib.sha256()
+        inputs = []
+        inputs.extend(sorted((self.repo_root / "config").glob("*.yaml")))
+        inputs.extend(sorted((self.repo_root / "scripts").glob("*.py")))
+        inputs.extend(sorted((self.repo_root / "scripts" / "templates").glob("*")))
+
+        for path in inputs:
+            hasher.update(str(path.relative_to(self.repo_root)).encode())
+            hasher.update(self._file_digest(path).encode())
+
+        self._global_digest = hasher.hexdigest()
+        return self._global_digest
+
+    def board_input_digest(self, board) -> str:
+        """Digest of everything a single board's output depends on"""
+        hasher = hashlib.sha256()
+        hasher.update(self._shared_input_digest().encode())
+        if board.keymap_file:
+            overlay = self.repo_root / "config" / board.keymap_file
+            hasher.update(board.keymap_file.encode())
+            hasher.update(self._file_digest(overlay).encode())
+        return hasher.hexdigest()
+
+    def is_fresh(self, board, digest: str) -> bool:
+        """
+        True if the board's inputs are unchanged since the last run and its
+        output directory still exists (a deleted output forces regeneration)
+        """
+        if self.entries.get(board.id) != digest:
+            return False
+        output_dir = self.repo_root / board.get_output_directory()
+        return output_dir.is_dir() and any(output_dir.iterdir())
+
+    def update(self, board, digest: str) -> None:
+        """Record a successful generation for the board"""
+        self.entries[board.id] = digest
+
+    def viz_is_fresh(self, name: str, digest: str, outputs) -> bool:
+        """
+        True if a visualization group's inputs are unchanged since the last
+        run and all of its output files still exist (out/ is preserved across
+        builds, but a manually deleted PDF still forces a re-render)
+        """
+        if self.viz_entries.get(name) != digest:
+            return False
+        return all(path.exists() for path in outputs)
+
+    def viz_update(self, name: str, digest: str) -> None:
+        """Record a successful render for a visualization group"""
+        self.viz_entries[name] = digest
@@ -188,7 +188,7 @@ class LayerCompiler:
         # 42->58 layout: use 3x6_3 logical layout then map into Lulu/Lily58 matrix
         elif layout_size == "custom_58_from_3x6":
             padded_42 = self._pad_to_3x6(keycodes, layer)
-            return self._pad_to_58_keys_from_3x6(padded_42, layer, board)
+            return self._pad_to_58_keys_from_3x6(padded_42)
 
 
         # 58-key boards (custom_58): Lulu, Lily58
@@ -302,15 +302,15 @@ class LayerCompiler:
         result.extend(keycodes[30:36])  # Thumbs
         return result
 
-    def _pad_to_58_keys_from_3x6(
-        self,
-        keycodes: List[str],
-        layer: Layer,
-        board: Board
-    ) -> List[str]:
+    @staticmethod
+    def _pad_to_58_keys_from_3x6(keycodes: List[str]) -> List[str]:
         """
         Pad 42-key 3x6_3 layout into the Lulu/Lily58 58-key matrix.
 
+        Static so the QMK generator can push marker streams through the
+        exact same reordering when deriving per-position tables (see
+        _handedness_flat) — the two must never drift apart.
+
         Mapping:
         - Row 0 (number row): 12 keys -> NONE (no numbers defined)
         - Main rows (rows 1-3): take 42-key 3x6 data (already includes pinkies)
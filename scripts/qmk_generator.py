@@ -7,7 +7,8 @@ Generates QMK C code files from compiled layers
 from pathlib import Path
 from typing import List, Dict, Tuple
 import re
-from data_model import Board, CompiledLayer, ComboConfiguration, Combo
+from data_model import Board, CompiledLayer, ComboConfiguration, Combo, ValidationError
+from layer_compiler import LayerCompiler
 
 
 class QMKGenerator:
@@ -23,7 +24,8 @@ class QMKGenerator:
         compiled_layers: List[CompiledLayer],
         output_dir: Path,
         combos: ComboConfiguration = None,
-        magic_config: 'MagicKeyConfiguration' = None
+        magic_config: 'MagicKeyConfiguration' = None,
+        handedness_override: List[str] = None
     ) -> Dict[str, str]:
         """
         Generate all QMK files for a board
@@ -34,6 +36,9 @@ class QMKGenerator:
             output_dir: Output directory path
             combos: Optional combo configuration
             magic_config: Optional magic key configuration
+            handedness_override: Optional per-position handedness list
+                ('L'/'R'/'*') for boards whose layout defies arithmetic
+                derivation (chordal_hold_handedness in the board keymap file)
 
         Returns:
             Dictionary of {filename: content} for all generated files
@@ -41,7 +46,7 @@ class QMKGenerator:
         files = {}
 
         # Generate keymap.c
-        files['keymap.c'] = self.generate_keymap_c(board, compiled_layers, combos, magic_config)
+        files['keymap.c'] = self.generate_keymap_c(board, compiled_layers, combos, magic_config, handedness_override)
 
         # Generate config.h
         files['config.h'] = self.generate_config_h(board, compiled_layers)
@@ -49,8 +54,14 @@ class QMKGenerator:
         # Generate rules.mk
         files['rules.mk'] = self.generate_rules_mk(board)
 
-        # Generate README.md with ASCII art visualization
-        files['README.md'] = self.generate_visualization(board, compiled_layers)
+        # Generate README.md with ASCII art visualization (reachable layers only)
+        viz_layers = [
+            layer for layer in compiled_layers
+            if board.base_layers is None
+            or not layer.name.startswith("BASE_")
+            or layer.name in board.base_layers
+        ]
+        files['README.md'] = self.generate_visualization(board, viz_layers)
 
         return files
 
@@ -59,7 +70,8 @@ class QMKGenerator:
         board: Board,
         compiled_layers: List[CompiledLayer],
         combos: ComboConfiguration = None,
-        magic_config: 'MagicKeyConfiguration' = None
+        magic_config: 'MagicKeyConfiguration' = None,
+        handedness_override: List[str] = None
     ) -> str:
         """
         Generate keymap.c file
@@ -73,15 +85,41 @@ class QMKGenerator:
         Returns:
             Complete keymap.c file content
         """
-        # Generate layer definitions
-        layer_defs = []
-        layer_names = [layer.name for layer in compiled_layers]
+        # Per-board dead-code pruning: BASE_* layers outside the board's
+        # base_layers allowlist keep their enum slot (layer indices in dario.h
+        # are shared across boards) but contribute no keymap rows, magic
+        # tables, or expansion strings to this board's build.
+        compiled_layers, pruned_layers = self._apply_base_layer_allowlist(board, compiled_layers)
+        emitted_layers = [layer for layer in compiled_layers if layer.name not in pruned_layers]
 
-        for layer in compiled_layers:
-            formatted = self.format_layer_definition(board, layer)
-            layer_defs.append(f"    [{layer.name}] = {formatted},")
+        # Generate layer definitions
+        layer_names = [layer.name for layer in emitted_layers]
 
-        layers_code = "\n".join(layer_defs)
+        if board.compress_keymap:
+            keymaps_code = self.generate_compressed_keymaps(board, compiled_layers, pruned_layers)
+        else:
+            layer_defs = []
+            for layer in emitted_layers:
+                formatted = self.format_layer_definition(board, layer)
+                layer_defs.append(f"    [{layer.name}] = {formatted},")
+            layers_code = "\n".join(layer_defs)
+            if pruned_layers:
+                # Pin the first dimension so pruned slots stay addressable even
+                # when the trailing layers happen to be the pruned ones.
+                keymaps_code = (
+                    f"// Pruned (not in this board's base_layers allowlist): "
+                    f"{', '.join(sorted(pruned_layers))}.\n"
+                    "// Their slots zero-fill to KC_NO; shared layer indices from dario.h stay valid.\n"
+                    f"const uint16_t PROGMEM keymaps[{len(compiled_layers)}][MATRIX_ROWS][MATRIX_COLS] = {{\n"
+                    f"{layers_code}\n"
+                    "};"
+                )
+            else:
+                keymaps_code = (
+                    "const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {\n"
+                    f"{layers_code}\n"
+                    "};"
+                )
 
         # Check if we need additional layer definitions (for board-specific layers like GAME)
         has_extra_layers = len(board.extra_layers) > 0
@@ -96,18 +134,27 @@ enum {{
 }};
 """
 
-        # Generate combo code if combos are provided
+        # Generate combo code if combos are provided (layer 0 keycodes stay
+        # runtime-accurate: a pruned layer 0 yields an empty membership bitmap)
         combo_code = ""
         if combos and combos.combos:
-            combo_code = "\n" + self.generate_combos_inline(combos, layer_names, compiled_layers, board)
+            combo_code = "\n" + self.generate_combos_inline(combos, layer_names, compiled_layers, board, pruned_layers)
+
+        # Generate chordal-hold thumb position and handedness tables
+        chordal_code = "\n" + self.generate_chordal_hold_inline(board, emitted_layers, handedness_override)
 
-        # Generate magic key code if magic_config is provided
+        # Generate per-position tapping-term table (home row mods)
+        tapping_term_code = "\n" + self.generate_tapping_term_inline(board, emitted_layers)
+
+        # Generate magic key code if magic_config is provided; pruned base
+        # layers drop out here, taking their pair tables, expansion strings,
+        # and macro keycodes with them
         magic_code = ""
         magic_enum = ""
         magic_handlers = ""
         self.magic_macros = {}
         if magic_config and magic_config.mappings:
-            magic_code, self.magic_macros = self.generate_magic_keys_inline(magic_config, compiled_layers)
+            magic_code, self.magic_macros = self.generate_magic_keys_inline(magic_config, emitted_layers)
             if self.magic_macros:
                 magic_enum = "\n" + self.generate_magic_macro_enum(self.magic_macros)
                 magic_handlers = "\n" + self.generate_magic_macro_handlers(self.magic_macros)
@@ -120,10 +167,55 @@ enum {{
 #include "dario.h"
 {magic_enum}
 {extra_layers_code}
-const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {{
-{layers_code}
-}};
-{combo_code}{magic_code}{magic_handlers}"""
+{keymaps_code}
+{chordal_code}{tapping_term_code}{combo_code}{magic_code}{magic_handlers}"""
+
+    def _apply_base_layer_allowlist(
+        self,
+        board: Board,
+        compiled_layers: List[CompiledLayer]
+    ) -> Tuple[List[CompiledLayer], set]:
+        """
+        Apply the board's base_layers allowlist (boards.yaml).
+
+        Returns (layers, pruned_names) where pruned BASE_* layers have their
+        keycodes replaced with KC_NO (matching what the zero-filled keymap
+        slot decodes to at runtime) and DF() references to pruned layers in
+        the surviving layers become KC_NO, so a pruned layout can never be
+        selected. With no allowlist this is a no-op.
+        """
+        if board.base_layers is None:
+            return compiled_layers, set()
+
+        compiled_names = {layer.name for layer in compiled_layers}
+        missing = [name for name in board.base_layers if name not in compiled_names]
+        if missing:
+            raise ValidationError(
+                f"Board {board.id}: base_layers allowlist references unknown "
+                f"layer(s): {', '.join(missing)}"
+            )
+
+        pruned = {
+            layer.name for layer in compiled_layers
+            if layer.name.startswith("BASE_") and layer.name not in board.base_layers
+        }
+        if not pruned:
+            return compiled_layers, pruned
+
+        df_subs = {f"DF({name})": "KC_NO" for name in pruned}
+        result = []
+        for layer in compiled_layers:
+            if layer.name in pruned:
+                keycodes = ["KC_NO"] * len(layer.keycodes)
+            else:
+                keycodes = [df_subs.get(kc, kc) for kc in layer.keycodes]
+            result.append(CompiledLayer(
+                name=layer.name,
+                board=board,
+                keycodes=keycodes,
+                firmware=layer.firmware
+            ))
+        return result, pruned
 
     def format_layer_definition(
         self,
@@ -514,13 +606,16 @@ combo_t key_combos[] = {{
         combos: ComboConfiguration,
         layer_names: List[str],
         compiled_layers: List[CompiledLayer],
-        board: Board
+        board: Board,
+        pruned_layers: set = frozenset()
     ) -> str:
         """
         Generate combo code inline for keymap.c (not separate files)
 
         This is identical to generate_combos_c but without file headers
-        and the #include directives since it's embedded in keymap.c
+        and the #include directives since it's embedded in keymap.c.
+        Layer-filter checks against pruned base layers are dropped (their
+        enum values can never be the current base layer on this board).
         """
         if not combos.combos:
             return ""
@@ -576,16 +671,30 @@ combo_t key_combos[] = {{
             for combo in combos.combos:
                 if combo.layers:
                     enum_name = f"COMBO_{combo.name.upper()}"
-                    layer_checks = " || ".join(f"layer == {ln}" for ln in combo.layers)
+                    reachable = [ln for ln in combo.layers if ln not in pruned_layers]
+                    if not reachable:
+                        filter_cases.append(f"""        case {enum_name}:
+            // Only active on pruned layers ({", ".join(combo.layers)})
+            return false;""")
+                        continue
+                    layer_checks = " || ".join(f"layer == {ln}" for ln in reachable)
                     filter_cases.append(f"""        case {enum_name}:
-            // Only active on {", ".join(combo.layers)}
+            // Only active on {", ".join(reachable)}
             return ({layer_checks});""")
 
             filter_cases_str = "\n".join(filter_cases)
             layer_filter_code = f"""
 
-// Layer filtering
+// Prior-idle gate + layer filtering. Non-member keys never reach this
+// callback — QMK's process_single_combo returns after the key-list lookup
+// fails — so there is no per-key membership pre-filter to add here.
 bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {{
+    // Require prior idle (mirrors ZMK's require-prior-idle-ms): mid-burst
+    // keys are never combo candidates, so they skip COMBO_TERM buffering
+    if (!combo_prior_idle_elapsed(record)) {{
+        return false;
+    }}
+
     uint8_t layer = get_current_base_layer();
 
     switch (combo_index) {{
@@ -691,6 +800,304 @@ combo_t key_combos[] = {{
         # Fallback (custom layouts): return canonical
         return canonical_positions
 
+    def _thumb_flat_positions(self, board: Board) -> List[int]:
+        """
+        Flat LAYOUT indices of the thumb keys (canonical row-wise 30-35)
+        for each board layout size.
+        """
+        layout = board.layout_size
+
+        # 36-key split (3x5_3): thumbs are the last 6 keys
+        if layout == "3x5_3":
+            return list(range(30, 36))
+
+        # 42-key split (3x6_3): thumbs at 36-41
+        if layout == "3x6_3":
+            return list(range(36, 42))
+
+        # 58-key (Lulu/Lily58): thumb row is the last 8 keys (50-57),
+        # outermost position on each side is NONE (see _pad_to_58_keys_from_3x6)
+        if layout in ("custom_58", "custom_58_from_3x6"):
+            return list(range(51, 57))
+
+        # 63-key Boaty: bottom row is 13 keys (50-62), thumbs are the last 6
+        # (L36(30)-L36(35) in config/boaty.yaml)
+        if layout == "custom_boaty":
+            return list(range(57, 63))
+
+        raise ValueError(f"Unknown layout size for thumb positions: {layout}")
+
+    def _handedness_flat(
+        self,
+        board: Board,
+        num_keys: int,
+        handedness_override: List[str] = None
+    ) -> List[str]:
+        """
+        Handedness character ('L'/'R', thumbs '*') per flat LAYOUT position.
+
+        Derived arithmetically for the split layouts; boards with layouts
+        that defy a simple split (the boaty monoblock with its numpad sail)
+        must provide a chordal_hold_handedness table in their keymap file.
+        """
+        if handedness_override is not None:
+            if len(handedness_override) != num_keys:
+                raise ValidationError(
+                    f"Board {board.id}: chordal_hold_handedness has "
+                    f"{len(handedness_override)} entries, expected {num_keys}"
+                )
+            bad = [h for h in handedness_override if h not in ("L", "R", "*")]
+            if bad:
+                raise ValidationError(
+                    f"Board {board.id}: chordal_hold_handedness entries must be "
+                    f"'L', 'R' or '*', got: {', '.join(bad)}"
+                )
+            return list(handedness_override)
+
+        layout = board.layout_size
+
+        # The 58-key argument stream is produced by
+        # LayerCompiler._pad_to_58_keys_from_3x6, which interleaves hands
+        # mid-row (e.g. right top + left bottom share one 12-wide row), so
+        # flat-index arithmetic misclassifies keys there. Push canonical
+        # 42-key indices through the same padding so the flag at each
+        # argument position describes the key the keymap actually places
+        # there, exactly as the keycodes themselves are ordered.
+        if layout == "custom_58_from_3x6":
+            markers = LayerCompiler._pad_to_58_keys_from_3x6(
+                [str(n) for n in range(42)]
+            )
+            # Hands for the pad-inserted NONE slots, which carry no canonical
+            # index: number row (0-11), the two center keys (42-43), and the
+            # outermost thumb-row pair (50, 57)
+            pad_hands = {i: ("L" if i < 6 else "R") for i in range(12)}
+            pad_hands.update({42: "L", 43: "R", 50: "L", 57: "R"})
+
+            thumb_positions = set(self._thumb_flat_positions(board))
+            hands = []
+            for i, marker in enumerate(markers):
+                if i in thumb_positions:
+                    hands.append("*")
+                elif marker == "NONE":
+                    hands.append(pad_hands[i])
+                else:
+                    # Canonical 42-key row-wise: columns 0-5 left, 6-11 right
+                    hands.append("L" if int(marker) % 12 < 6 else "R")
+            return hands
+
+        thumb_positions = set(self._thumb_flat_positions(board))
+        hands = []
+        for i in range(num_keys):
+            if i in thumb_positions:
+                hands.append("*")
+            elif layout == "3x5_3":
+                hands.append("L" if (i % 10) < 5 else "R")
+            elif layout == "3x6_3":
+                hands.append("L" if (i % 12) < 6 else "R")
+            else:
+                raise ValidationError(
+                    f"Board {board.id} ({layout}): cannot derive handedness; "
+                    f"add a chordal_hold_handedness table to {board.keymap_file or 'the board keymap file'}"
+                )
+        return hands
+
+    def generate_chordal_hold_inline(
+        self,
+        board: Board,
+        compiled_layers: List[CompiledLayer],
+        handedness_override: List[str] = None
+    ) -> str:
+        """
+        Generate the per-board chordal-hold tables used by get_chordal_hold().
+
+        Emits MATRIX_ROWS x MATRIX_COLS tables through the board's LAYOUT
+        macro: a thumb bitmap for the thumb exemption, and QMK's
+        chordal_hold_layout handedness table so the hand of a key is a single
+        PROGMEM load (via chordal_hold_handedness()) instead of row/col
+        arithmetic — which was simply wrong for non-rectangular monoblocks.
+        """
+        num_keys = len(compiled_layers[0].keycodes)
+        thumb_positions = set(self._thumb_flat_positions(board))
+
+        flags = ["1" if i in thumb_positions else "0" for i in range(num_keys)]
+        flags_layer = CompiledLayer(
+            name="thumb_positions",
+            board=board,
+            keycodes=flags,
+            firmware="qmk"
+        )
+        formatted = self.format_layer_definition(board, flags_layer)
+
+        hands = self._handedness_flat(board, num_keys, handedness_override)
+        hands_layer = CompiledLayer(
+            name="chordal_hold_layout",
+            board=board,
+            keycodes=[f"'{h}'" for h in hands],
+            firmware="qmk"
+        )
+        hands_formatted = self.format_layer_definition(board, hands_layer)
+
+        return f"""
+#ifdef CHORDAL_HOLD
+// Thumb key positions (canonical row-wise 30-35) mapped through the board's
+// LAYOUT macro. 1 = thumb (exempt from the opposite-hand rule), 0 = alpha.
+// Read by is_thumb_position() in dario.c.
+const uint8_t PROGMEM thumb_positions[MATRIX_ROWS][MATRIX_COLS] = {formatted};
+
+// Handedness per key ('L'/'R'; thumbs '*' = either hand), read by QMK's
+// chordal_hold_handedness() from get_chordal_hold() in dario.c.
+const char PROGMEM chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] = {hands_formatted};
+#endif  // CHORDAL_HOLD
+"""
+
+    def generate_compressed_keymaps(
+        self,
+        board: Board,
+        compiled_layers: List[CompiledLayer],
+        pruned_layers: set = frozenset()
+    ) -> str:
+        """
+        Generate dictionary-compressed keymap storage (compress_keymap: true).
+
+        Instead of the usual 16-bit keymaps[][][] array, emit a deduplicated
+        keycode dictionary plus 8-bit per-position indices, decoded by
+        overriding the weak keycode_at_keymap_location() accessor. Per-position
+        storage halves, and the dictionary cost is amortized as layers and
+        base layouts are added — flash headroom for the atmega32u4 boards.
+
+        Pruned layers (base_layers allowlist) emit no index table and add no
+        dictionary entries; their zero-filled slots decode to KC_NO.
+        """
+        # Index 0 is reserved for KC_NO so the LAYOUT macro's implicit
+        # zero-padding of unused matrix slots decodes correctly.
+        dictionary = ["KC_NO"]
+        index_of = {"KC_NO": 0}
+        for layer in compiled_layers:
+            if layer.name in pruned_layers:
+                continue
+            for keycode in layer.keycodes:
+                if keycode not in index_of:
+                    index_of[keycode] = len(dictionary)
+                    dictionary.append(keycode)
+
+        if len(dictionary) > 256:
+            raise ValueError(
+                f"Board {board.id}: {len(dictionary)} unique keycodes exceed the "
+                f"8-bit dictionary limit; disable compress_keymap for this board"
+            )
+
+        layer_count = len(compiled_layers)
+
+        dict_lines = [f"    {kc},  // {i}" for i, kc in enumerate(dictionary)]
+        dict_code = "\n".join(dict_lines)
+
+        index_defs = []
+        for layer in compiled_layers:
+            if layer.name in pruned_layers:
+                continue
+            indices = [str(index_of[kc]) for kc in layer.keycodes]
+            index_layer = CompiledLayer(
+                name=layer.name,
+                board=board,
+                keycodes=indices,
+                firmware="qmk"
+            )
+            formatted = self.format_layer_definition(board, index_layer)
+            index_defs.append(f"    [{layer.name}] = {formatted},")
+        indices_code = "\n".join(index_defs)
+
+        pruned_note = ""
+        if pruned_layers:
+            pruned_note = (
+                f"// Pruned (not in this board's base_layers allowlist): "
+                f"{', '.join(sorted(pruned_layers))}; their slots decode to KC_NO.\n"
+            )
+
+        return f"""// Dictionary-compressed keymap storage (compress_keymap: true in boards.yaml)
+// {len(dictionary)} unique keycodes across {layer_count} layers; each position stores an
+// 8-bit dictionary index, decoded by keycode_at_keymap_location() below.
+{pruned_note}static const uint16_t PROGMEM keymap_dict[{len(dictionary)}] = {{
+{dict_code}
+}};
+
+static const uint8_t PROGMEM keymap_indices[{layer_count}][MATRIX_ROWS][MATRIX_COLS] = {{
+{indices_code}
+}};
+
+// Core introspection references the keymaps symbol directly, so keep a single
+// all-KC_NO placeholder layer and override the weak accessors instead.
+const uint16_t PROGMEM keymaps[1][MATRIX_ROWS][MATRIX_COLS] = {{0}};
+
+uint8_t keymap_layer_count(void) {{
+    return {layer_count};
+}}
+
+uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t col) {{
+    if (layer_num < {layer_count} && row < MATRIX_ROWS && col < MATRIX_COLS) {{
+        uint8_t idx = pgm_read_byte(&keymap_indices[layer_num][row][col]);
+        return pgm_read_word(&keymap_dict[idx]);
+    }}
+    return KC_NO;
+}}"""
+
+    # Home row mod pattern in compiled QMK keycodes (e.g. "LGUI_T(KC_N)")
+    HRM_PATTERN = re.compile(r'^L(GUI|ALT|CTL|SFT)_T\(')
+
+    def generate_tapping_term_inline(
+        self,
+        board: Board,
+        compiled_layers: List[CompiledLayer]
+    ) -> str:
+        """
+        Generate the per-board home-row-mod position table used by
+        get_tapping_term() in dario.c.
+
+        HRM positions (canonical home row 10-19) are derived by scanning the
+        compiled BASE_* layers for mod-tap keycodes outside the thumb cluster,
+        so every base layout gets TAPPING_TERM_HRM automatically and the lookup
+        is a single PROGMEM read instead of a growing keycode switch.
+        """
+        num_keys = len(compiled_layers[0].keycodes)
+        thumb_positions = set(self._thumb_flat_positions(board))
+
+        hrm_positions = set()
+        for layer in compiled_layers:
+            if not layer.name.startswith("BASE_"):
+                continue
+            for idx, keycode in enumerate(layer.keycodes):
+                if idx in thumb_positions:
+                    continue  # Thumb mod-taps keep the default term
+                if self.HRM_PATTERN.match(keycode):
+                    hrm_positions.add(idx)
+
+        flags = ["1" if i in hrm_positions else "0" for i in range(num_keys)]
+        flags_layer = CompiledLayer(
+            name="hrm_positions",
+            board=board,
+            keycodes=flags,
+            firmware="qmk"
+        )
+        formatted = self.format_layer_definition(board, flags_layer)
+
+        return f"""
+// Home row mod positions (canonical row-wise 10-19), derived from the
+// compiled BASE_* layers. 1 = home row mod (TAPPING_TERM_HRM), 0 = default.
+// Read by get_tapping_term() in dario.c.
+const uint8_t PROGMEM hrm_positions[MATRIX_ROWS][MATRIX_COLS] = {formatted};
+"""
+
+    # HID usage values for the basic keycodes that appear as magic-key lookup
+    # keys. Used to sort the generated (keycode, alt) pair tables so the
+    # firmware-side binary search sees the same ordering it compares at runtime.
+    BASIC_KEYCODE_VALUES = {
+        **{f"KC_{chr(c)}": 0x04 + (c - ord('A')) for c in range(ord('A'), ord('Z') + 1)},
+        **{f"KC_{d}": 0x1E + i for i, d in enumerate("1234567890")},
+        "KC_ENT": 0x28, "KC_ESC": 0x29, "KC_BSPC": 0x2A, "KC_TAB": 0x2B,
+        "KC_SPC": 0x2C, "KC_MINS": 0x2D, "KC_EQL": 0x2E, "KC_LBRC": 0x2F,
+        "KC_RBRC": 0x30, "KC_BSLS": 0x31, "KC_SCLN": 0x33, "KC_QUOT": 0x34,
+        "KC_GRV": 0x35, "KC_COMM": 0x36, "KC_DOT": 0x37, "KC_SLSH": 0x38,
+    }
+
     def generate_magic_keys_inline(
         self,
         magic_config: 'MagicKeyConfiguration',
@@ -699,8 +1106,11 @@ combo_t key_combos[] = {{
         """
         Generate QMK alternate repeat key configuration inline in keymap.c
 
-        Uses get_alt_repeat_key_keycode_user() callback to provide
-        base-layer-specific alternate key mappings.
+        Emits one sorted PROGMEM (keycode, alt) pair table per base layer and a
+        shared binary-search helper, so get_alt_repeat_key_keycode_user() is a
+        bounded O(log n) lookup instead of a nested keycode switch. The lookup
+        runs on every keypress (via the training check in magic_process_record),
+        so this keeps the per-keystroke cost flat as layouts and mappings grow.
 
         Args:
             magic_config: MagicKeyConfiguration with base-layer mappings
@@ -719,24 +1129,22 @@ combo_t key_combos[] = {{
         code_lines = [
             "",
             "// Magic key configuration (alternate repeat key)",
-            "uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {",
-            "    // Get current base layer (not active overlay)",
-            "    uint8_t base_layer = get_current_base_layer();",
-            "    ",
+            "// Per-base-layer (keycode, alt) pairs sorted by HID keycode value for",
+            "// binary search. Tables live in PROGMEM to keep RAM/flash cost small.",
+            "typedef struct {",
+            "    uint16_t keycode;",
+            "    uint16_t alt;",
+            "} magic_pair_t;",
+            "",
         ]
 
-        # Generate switch statement for each base layer
+        # One sorted table per base layer compiled for this board
+        table_names: Dict[str, str] = {}
         for base_layer, mapping in magic_config.mappings.items():
             if base_layer not in layer_map:
                 continue  # Skip if layer not compiled for this board
 
-            # Only check the base layer itself, not derived layers
-            # (base layer tracking handles this now)
-            code_lines.append(f"    // {base_layer} family")
-            code_lines.append(f"    if (base_layer == {base_layer}) {{")
-            code_lines.append("        switch (keycode) {")
-
-            # Generate mappings
+            pairs = []
             for prev_key, alt_key in mapping.mappings.items():
                 prev_qmk = self._translate_simple_keycode(prev_key)
                 macro_name = None
@@ -750,26 +1158,69 @@ combo_t key_combos[] = {{
                     alt_qmk = macro_name
                 else:
                     alt_qmk = self._translate_simple_keycode(alt_key)
-                code_lines.append(f"            case {prev_qmk}: return {alt_qmk};")
 
-            code_lines.append("        }")
-            code_lines.append("    }")
+                if prev_qmk not in self.BASIC_KEYCODE_VALUES:
+                    raise ValueError(
+                        f"Magic key '{prev_key}' ({prev_qmk}) has no known HID value; "
+                        f"add it to BASIC_KEYCODE_VALUES so the table stays sorted"
+                    )
+                pairs.append((self.BASIC_KEYCODE_VALUES[prev_qmk], prev_qmk, alt_qmk))
+
+            pairs.sort(key=lambda p: p[0])
+
+            table_name = f"magic_pairs_{base_layer.lower()}"
+            table_names[base_layer] = table_name
+            code_lines.append(f"static const magic_pair_t PROGMEM {table_name}[] = {{")
+            for _, prev_qmk, alt_qmk in pairs:
+                code_lines.append(f"    {{{prev_qmk:10}, {alt_qmk}}},")
+            code_lines.append("};")
             code_lines.append("")
 
-        # Handle default behavior
+        # Default behavior shared across base layers
         default_behavior = list(magic_config.mappings.values())[0].default
         if default_behavior == "REPEAT":
-            code_lines.append("    // Default: repeat previous key")
-            code_lines.append("    return QK_REP;")
+            default_qmk = "QK_REP"  # repeat previous key
         elif default_behavior == "NONE":
-            code_lines.append("    // Default: do nothing")
-            code_lines.append("    return KC_NO;")
+            default_qmk = "KC_NO"  # do nothing
         else:
-            code_lines.append(f"    // Default: {default_behavior}")
-            code_lines.append(f"    return {self._translate_simple_keycode(default_behavior)};")
+            default_qmk = self._translate_simple_keycode(default_behavior)
+
+        code_lines.extend([
+            "static uint16_t magic_pair_lookup(const magic_pair_t *pairs, uint8_t count, uint16_t keycode) {",
+            "    uint8_t lo = 0;",
+            "    uint8_t hi = count;",
+            "    while (lo < hi) {",
+            "        uint8_t mid = (uint8_t)((lo + hi) / 2);",
+            "        uint16_t key = pgm_read_word(&pairs[mid].keycode);",
+            "        if (key == keycode) {",
+            "            return pgm_read_word(&pairs[mid].alt);",
+            "        }",
+            "        if (key < keycode) {",
+            "            lo = mid + 1;",
+            "        } else {",
+            "            hi = mid;",
+            "        }",
+            "    }",
+            f"    return {default_qmk};  // Default: {default_behavior}",
+            "}",
+            "",
+            "uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {",
+            "    // Dispatch on current base layer (not active overlay)",
+            "    switch (get_current_base_layer()) {",
+        ])
+
+        for base_layer, table_name in table_names.items():
+            code_lines.append(f"        case {base_layer}:")
+            code_lines.append(
+                f"            return magic_pair_lookup({table_name}, ARRAY_SIZE({table_name}), keycode);"
+            )
 
-        code_lines.append("}")
-        code_lines.append("")
+        code_lines.extend([
+            "    }",
+            f"    return {default_qmk};",
+            "}",
+            "",
+        ])
 
         return "\n".join(code_lines), macro_map
 
@@ -859,14 +1310,11 @@ combo_t key_combos[] = {{
 
         names = sorted(macro_map.keys())
         lines = [
-            "#ifndef MACRO_GITHUB_URL",
-            "#define MACRO_GITHUB_URL SAFE_RANGE",
-            "#endif",
-            "",
+            "// Continues after the shared custom keycodes in dario.h",
             "enum magic_macros {",
         ]
 
-        lines.append(f"    {names[0]} = MACRO_GITHUB_URL + 1,")
+        lines.append(f"    {names[0]} = CUSTOM_KEYCODES_END,")
         for name in names[1:]:
             lines.append(f"    {name},")
         lines.append("};")
@@ -892,35 +1340,85 @@ combo_t key_combos[] = {{
         # Fallback: use the character itself; likely to be caught by compiler if invalid
         return f"KC_{ch.upper()}"
 
+    def _build_string_pool(self, strings: List[str]) -> Tuple[List[str], Dict[str, int]]:
+        """
+        Build a deduplicated string pool with shared suffixes.
+
+        Strings are placed longest-first; a string that already occurs in the
+        pool ending at a terminator (i.e. is a suffix of a placed string, or
+        an exact duplicate) points into the existing bytes instead of being
+        appended. Returns the placed segments (each NUL-terminated) and an
+        offset into the pool for every input string.
+        """
+        pool = ""
+        segments: List[str] = []
+        offsets: Dict[str, int] = {}
+        for text in sorted(set(strings), key=lambda s: (-len(s), s)):
+            probe = text + "\0"
+            index = pool.find(probe)
+            if index == -1:
+                index = len(pool)
+                pool += probe
+                segments.append(text)
+            offsets[text] = index
+        return segments, offsets
+
     def generate_magic_macro_handlers(self, macro_map: Dict[str, str]) -> str:
         """
-        Emit process_magic_record() helper that SEND_STRINGs magic expansions.
+        Emit process_magic_record() and the PROGMEM expansion string pool.
+
+        Expansion texts are deduplicated into a single pool with shared
+        suffixes ("the" appears once however many base layers map to it),
+        indexed by a compact per-macro offset table. The handler is a range
+        check plus a table read instead of a switch of string literals.
         """
         if not macro_map:
             return ""
 
+        names = sorted(macro_map.keys())
+        texts = {name: macro_map[name].lower() for name in names}
+        segments, offsets = self._build_string_pool(list(texts.values()))
+
+        pool_size = sum(len(segment) + 1 for segment in segments)
+        offset_type = "uint8_t" if pool_size <= 0xFF else "uint16_t"
+        offset_read = "pgm_read_byte" if pool_size <= 0xFF else "pgm_read_word"
+
         lines = [
             "",
-            "bool process_magic_record(uint16_t keycode, keyrecord_t *record) {",
-            "    if (!record->event.pressed) {",
-            "        return true;",
-            "    }",
-            "    switch (keycode) {",
+            f"// Expansion text pool: {len(names)} macros deduplicated into "
+            f"{pool_size} bytes ({len(segments)} unique strings; shared",
+            "// suffixes reuse the same terminator). One quoted segment per pooled string;",
+            "// adjacent literals concatenate, so embedded NULs stay unambiguous.",
+            "static const char magic_pool[] PROGMEM =",
         ]
+        running = 0
+        for segment in segments:
+            escaped = segment.replace("\\", "\\\\").replace("\"", "\\\"")
+            lines.append(f"    \"{escaped}\\0\"  // offset {running}")
+            running += len(segment) + 1
+        lines[-1] = lines[-1].replace("\"  //", "\";  //", 1)
 
-        for name in sorted(macro_map.keys()):
-            text = macro_map[name]
-            # Default to lowercase output for magic text expansions
-            text = text.lower()
-            escaped = text.replace("\\", "\\\\").replace("\"", "\\\"")
-            lines.append(f"        case {name}:")
-            lines.append(f"            SEND_STRING(\"{escaped}\");")
-            lines.append(f"            return false;")
-
-        lines.append("    }")
-        lines.append("    return true;")
-        lines.append("}")
         lines.append("")
+        lines.append(f"// Pool offset per macro, indexed by keycode - {names[0]}")
+        lines.append(f"static const {offset_type} magic_pool_offsets[] PROGMEM = {{")
+        for name in names:
+            escaped = texts[name].replace("\\", "\\\\").replace("\"", "\\\"")
+            lines.append(f"    {offsets[texts[name]]:3d},  // {name} -> \"{escaped}\"")
+        lines.append("};")
+
+        lines.extend([
+            "",
+            "bool process_magic_record(uint16_t keycode, keyrecord_t *record) {",
+            f"    if (keycode < {names[0]} || keycode > {names[-1]}) {{",
+            "        return true;",
+            "    }",
+            "    if (record->event.pressed) {",
+            f"        send_queue_string_P(&magic_pool[{offset_read}(&magic_pool_offsets[keycode - {names[0]}])]);",
+            "    }",
+            "    return false;",
+            "}",
+            "",
+        ])
 
         # Helper used by magic.c training: map magic macro keycodes to the first
         # key they would emit, so we can detect direct bigrams and punish with '#'.
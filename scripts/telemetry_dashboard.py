@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""
+Live dashboard for the raw HID telemetry channel
+
+Polls the keyboard (qmk/users/dario/telemetry.c) for 32-byte binary
+snapshots and renders scan-rate stats plus decoded trace events in the
+terminal. Works on the boards where CONSOLE_ENABLE is off (AVR/V-USB).
+
+Usage:
+    python3 scripts/telemetry_dashboard.py [--vid 0xA8F8 --pid 0x1830]
+    python3 scripts/telemetry_dashboard.py --list
+
+Requires hidapi:  pip install hidapi
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+try:
+    import hid
+except ImportError:
+    print("❌ hidapi is required: pip install hidapi")
+    sys.exit(1)
+
+# Protocol constants — keep in sync with qmk/users/dario/telemetry.h
+TELEMETRY_MAGIC = 0xD7
+TELEMETRY_VERSION = 1
+TELEMETRY_REPORT_SIZE = 32
+TELEMETRY_CMD_SNAPSHOT = 0x01
+EVENTS_PER_REPORT = 3
+EVENT_RECORD_SIZE = 7
+
+# QMK raw HID interface identifiers
+RAW_USAGE_PAGE = 0xFF60
+RAW_USAGE = 0x61
+
+# Mirrors enum trace_event_type in qmk/users/dario/trace.h
+EVENT_NAMES = {
+    0: "COMBO_KEY",
+    1: "COMBO_EVENT",
+    2: "AREP_TRIGGER",
+    3: "AREP_RESOLVE",
+    4: "AREP_REPEAT",
+    5: "AREP_MODTAP",
+    6: "TRAIN_CHECK",
+    7: "TRAIN_BLOCK",
+    8: "REMEMBER",
+    9: "REMEMBER_SKIP",
+    10: "REP",
+    11: "BOOT_FIRST_KEY",
+}
+
+# Mirrors enum layers in qmk/users/dario/dario.h
+LAYER_NAMES = [
+    "BASE_NIGHT", "BASE_GALLIUM", "BASE_DUSK", "BASE_RACKET",
+    "FUN", "NUM_NIGHT", "SYM_NIGHT", "NAV_NIGHT", "MEDIA_NIGHT",
+]
+
+SPARK_CHARS = " ▁▂▃▄▅▆▇█"
+HISTORY_LEN = 60
+
+
+def find_raw_interfaces(vid=None, pid=None):
+    """All raw HID interfaces, optionally filtered by vendor/product ID"""
+    matches = []
+    for info in hid.enumerate():
+        if info.get("usage_page") != RAW_USAGE_PAGE or info.get("usage") != RAW_USAGE:
+            continue
+        if vid is not None and info["vendor_id"] != vid:
+            continue
+        if pid is not None and info["product_id"] != pid:
+            continue
+        matches.append(info)
+    return matches
+
+
+def decode_snapshot(report):
+    """Decode one 32-byte telemetry report; returns None if not ours"""
+    if len(report) < TELEMETRY_REPORT_SIZE or report[0] != TELEMETRY_MAGIC:
+        return None
+    if report[1] != TELEMETRY_VERSION:
+        raise ValueError(f"Protocol version mismatch: firmware v{report[1]}, dashboard v{TELEMETRY_VERSION}")
+
+    scans_per_sec, mean_scan_us = struct.unpack_from("<HH", bytes(report), 2)
+    snapshot = {
+        "scans_per_sec": scans_per_sec,
+        "mean_scan_us": mean_scan_us,
+        "p99_interval_ms": report[6],
+        "max_interval_ms": report[7],
+        "base_layer": report[8],
+        "events": [],
+    }
+    for i in range(min(report[9], EVENTS_PER_REPORT)):
+        offset = 10 + i * EVENT_RECORD_SIZE
+        etype = report[offset]
+        etime, a, b = struct.unpack_from("<HHH", bytes(report), offset + 1)
+        snapshot["events"].append({"type": etype, "time": etime, "a": a, "b": b})
+    return snapshot
+
+
+def format_event(event):
+    name = EVENT_NAMES.get(event["type"], f"UNKNOWN_{event['type']}")
+    detail = f"a=0x{event['a']:04X} b=0x{event['b']:04X}"
+    if name == "COMBO_KEY":
+        detail = f"keycode=0x{event['a']:04X} row={event['b'] >> 8} col={event['b'] & 0xFF}"
+    elif name == "COMBO_EVENT":
+        detail = f"combo={event['a']} layer={event['b'] >> 8} {'press' if event['b'] & 1 else 'release'}"
+    elif name.startswith("AREP") or name.startswith("TRAIN") or name == "REP":
+        detail = f"key=0x{event['a']:04X} alt=0x{event['b']:04X}"
+    return f"t={event['time']:5d}ms {name:13s} {detail}"
+
+
+def sparkline(history, lo=0, hi=None):
+    if not history:
+        return ""
+    hi = hi or max(history) or 1
+    span = max(hi - lo, 1)
+    return "".join(
+        SPARK_CHARS[min(len(SPARK_CHARS) - 1, (v - lo) * (len(SPARK_CHARS) - 1) // span)]
+        for v in history
+    )
+
+
+def run_dashboard(device, interval):
+    history = []
+    event_log = []
+    request = bytes([0x00, TELEMETRY_CMD_SNAPSHOT] + [0x00] * (TELEMETRY_REPORT_SIZE - 1))
+
+    print("\033[2J", end="")  # clear screen once; then redraw in place
+    while True:
+        device.write(request)
+        report = device.read(TELEMETRY_REPORT_SIZE, timeout_ms=250)
+        snapshot = decode_snapshot(report) if report else None
+
+        if snapshot:
+            history.append(snapshot["scans_per_sec"])
+            history[:] = history[-HISTORY_LEN:]
+            for event in snapshot["events"]:
+                event_log.append(format_event(event))
+            event_log[:] = event_log[-12:]
+
+            layer = snapshot["base_layer"]
+            layer_name = LAYER_NAMES[layer] if layer < len(LAYER_NAMES) else f"layer {layer}"
+            lines = [
+                "── keyboard telemetry ─────────────────────────────────────",
+                f"  base layer : {layer_name}",
+                f"  scan rate  : {snapshot['scans_per_sec']:5d}/s   mean {snapshot['mean_scan_us']}us",
+                f"  intervals  : p99 {snapshot['p99_interval_ms']}ms   max {snapshot['max_interval_ms']}ms",
+                f"  rate (60s) : {sparkline(history)}",
+                "── events ─────────────────────────────────────────────────",
+            ] + [f"  {line}" for line in event_log]
+        else:
+            lines = ["── keyboard telemetry ── (no response; is RAW_ENABLE on?) ──"]
+
+        print("\033[H", end="")  # home cursor
+        for line in lines:
+            print(f"{line}\033[K")
+        print("\033[J", end="", flush=True)
+
+        time.sleep(interval)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Live raw HID telemetry dashboard")
+    parser.add_argument("--vid", type=lambda v: int(v, 0), help="USB vendor ID (e.g. 0xA8F8)")
+    parser.add_argument("--pid", type=lambda v: int(v, 0), help="USB product ID")
+    parser.add_argument("--interval", type=float, default=0.1, help="Poll interval in seconds (default 0.1)")
+    parser.add_argument("--list", action="store_true", help="List raw HID interfaces and exit")
+    args = parser.parse_args()
+
+    interfaces = find_raw_interfaces(args.vid, args.pid)
+
+    if args.list:
+        if not interfaces:
+            print("No raw HID interfaces found")
+        for info in interfaces:
+            print(f"  {info['vendor_id']:04X}:{info['product_id']:04X}  "
+                  f"{info.get('manufacturer_string', '?')} {info.get('product_string', '?')}")
+        return 0
+
+    if not interfaces:
+        print("❌ No raw HID interface found (check --vid/--pid, or build with RAW_ENABLE = yes)")
+        return 1
+    if len(interfaces) > 1 and args.vid is None:
+        print("Multiple raw HID interfaces found; pick one with --vid/--pid:")
+        for info in interfaces:
+            print(f"  {info['vendor_id']:04X}:{info['product_id']:04X}  {info.get('product_string', '?')}")
+        return 1
+
+    device = hid.device()
+    device.open_path(interfaces[0]["path"])
+    try:
+        run_dashboard(device, args.interval)
+    except KeyboardInterrupt:
+        print()
+    finally:
+        device.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
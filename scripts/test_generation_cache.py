@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+Unit tests for generation_cache.py and file_writer.py write-if-changed
+"""
+
+import pytest
+from pathlib import Path
+import sys
+
+# Add scripts directory to path
+sys.path.insert(0, str(Path(__file__).parent))
+
+from generation_cache import GenerationCache
+from file_writer import FileSystemWriter
+
+
+class FakeBoard:
+    """Minimal stand-in for data_model.Board"""
+
+    def __init__(self, board_id, output_dir, keymap_file=None):
+        self.id = board_id
+        self.keymap_file = keymap_file
+        self._output_dir = output_dir
+
+    def get_output_directory(self):
+        return self._output_dir
+
+
+@pytest.fixture
+def fake_repo(tmp_path):
+    """Minimal repo tree with config/scripts/templates inputs"""
+    (tmp_path / "config").mkdir()
+    (tmp_path / "config" / "keymap.yaml").write_text("layers: {}\n")
+    (tmp_path / "scripts" / "templates").mkdir(parents=True)
+    (tmp_path / "scripts" / "generate.py").write_text("# generator\n")
+    return tmp_path
+
+
+def test_fresh_after_update(fake_repo):
+    cache = GenerationCache(fake_repo)
+    out = fake_repo / "out" / "board_a"
+    out.mkdir(parents=True)
+    (out / "keymap.c").write_text("// generated\n")
+
+    board = FakeBoard("board_a", "out/board_a")
+    digest = cache.board_input_digest(board)
+    assert not cache.is_fresh(board, digest)
+
+    cache.update(board, digest)
+    assert cache.is_fresh(board, digest)
+
+
+def test_input_change_invalidates(fake_repo):
+    cache = GenerationCache(fake_repo)
+    out = fake_repo / "out" / "board_a"
+    out.mkdir(parents=True)
+    (out / "keymap.c").write_text("// generated\n")
+
+    board = FakeBoard("board_a", "out/board_a")
+    cache.update(board, cache.board_input_digest(board))
+    cache.save()
+
+    (fake_repo / "config" / "keymap.yaml").write_text("layers: {changed: true}\n")
+
+    # New cache instance simulates the next run
+    cache2 = GenerationCache(fake_repo)
+    assert not cache2.is_fresh(board, cache2.board_input_digest(board))
+
+
+def test_missing_output_forces_regeneration(fake_repo):
+    cache = GenerationCache(fake_repo)
+    board = FakeBoard("board_a", "out/board_a")
+    digest = cache.board_input_digest(board)
+    cache.update(board, digest)
+
+    # Output directory was never created (or was deleted)
+    assert not cache.is_fresh(board, digest)
+
+
+def test_write_all_preserves_unchanged_mtimes(tmp_path):
+    out = tmp_path / "gen"
+    assert FileSystemWriter.write_all(out, {"a.c": "aaa\n", "b.c": "bbb\n"}) == 2
+
+    mtime_before = (out / "a.c").stat().st_mtime_ns
+    written = FileSystemWriter.write_all(out, {"a.c": "aaa\n", "b.c": "changed\n"})
+    assert written == 1
+    assert (out / "a.c").stat().st_mtime_ns == mtime_before
+    assert (out / "b.c").read_text() == "changed\n"
+
+
+def test_write_all_removes_stale_files(tmp_path):
+    out = tmp_path / "gen"
+    FileSystemWriter.write_all(out, {"a.c": "aaa\n", "stale.c": "old\n"})
+    FileSystemWriter.write_all(out, {"a.c": "aaa\n"})
+    assert not (out / "stale.c").exists()
+    assert (out / "a.c").exists()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+Unit tests for per-board base-layer pruning in qmk_generator.py
+"""
+
+import pytest
+from pathlib import Path
+import sys
+
+# Add scripts directory to path
+sys.path.insert(0, str(Path(__file__).parent))
+
+from data_model import Board, CompiledLayer, ValidationError
+from qmk_generator import QMKGenerator
+
+
+def make_board(base_layers=None, **kwargs):
+    return Board(
+        id="testboard",
+        name="Test Board",
+        firmware="qmk",
+        qmk_keyboard="test/board",
+        layout_size="3x5_3",
+        base_layers=base_layers,
+        **kwargs
+    )
+
+
+def make_layer(board, name, fill="KC_A"):
+    keycodes = [fill] * 36
+    return CompiledLayer(name=name, board=board, keycodes=keycodes, firmware="qmk")
+
+
+def test_no_allowlist_is_noop():
+    """Without base_layers, layers pass through untouched"""
+    board = make_board()
+    layers = [make_layer(board, "BASE_NIGHT"), make_layer(board, "NAV_NIGHT")]
+    result, pruned = QMKGenerator()._apply_base_layer_allowlist(board, layers)
+    assert result is layers
+    assert pruned == set()
+
+
+def test_pruned_layer_zeroed_and_df_refs_removed():
+    """Pruned base layers blank out; DF() references to them become KC_NO"""
+    board = make_board(base_layers=["BASE_NIGHT"])
+    night = make_layer(board, "BASE_NIGHT")
+    gallium = make_layer(board, "BASE_GALLIUM", fill="KC_B")
+    media = make_layer(board, "MEDIA_NIGHT", fill="KC_C")
+    media.keycodes[0] = "DF(BASE_GALLIUM)"
+    media.keycodes[1] = "DF(BASE_NIGHT)"
+
+    result, pruned = QMKGenerator()._apply_base_layer_allowlist(board, [night, gallium, media])
+
+    assert pruned == {"BASE_GALLIUM"}
+    assert all(kc == "KC_NO" for kc in result[1].keycodes)
+    assert result[2].keycodes[0] == "KC_NO"  # switch to pruned layout removed
+    assert result[2].keycodes[1] == "DF(BASE_NIGHT)"  # reachable switch kept
+
+
+def test_non_base_layers_never_pruned():
+    """The allowlist only applies to BASE_* layers"""
+    board = make_board(base_layers=["BASE_NIGHT"])
+    layers = [make_layer(board, "BASE_NIGHT"), make_layer(board, "FUN", fill="KC_F1")]
+    result, pruned = QMKGenerator()._apply_base_layer_allowlist(board, layers)
+    assert pruned == set()
+    assert result[1].keycodes[0] == "KC_F1"
+
+
+def test_unknown_allowlist_entry_raises():
+    """Allowlisting a layer that isn't compiled is a configuration error"""
+    board = make_board(base_layers=["BASE_NIGHT", "BASE_TYPO"])
+    layers = [make_layer(board, "BASE_NIGHT")]
+    with pytest.raises(ValidationError):
+        QMKGenerator()._apply_base_layer_allowlist(board, layers)
+
+
+def test_compressed_keymap_skips_pruned_dictionary_entries():
+    """Pruned layers contribute no dictionary entries or index tables"""
+    board = make_board(base_layers=["BASE_NIGHT"], compress_keymap=True)
+    night = make_layer(board, "BASE_NIGHT")
+    gallium = make_layer(board, "BASE_GALLIUM", fill="KC_UNIQUE")
+
+    code = QMKGenerator().generate_compressed_keymaps(
+        board, [night, gallium], pruned_layers={"BASE_GALLIUM"}
+    )
+
+    assert "KC_UNIQUE" not in code
+    assert "[BASE_GALLIUM]" not in code
+    assert "keymap_indices[2]" in code  # slot count includes the pruned layer
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main([__file__, "-v"]))
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+Unit tests for the indexed cross-reference checks in validator.py
+"""
+
+import pytest
+from pathlib import Path
+import sys
+
+# Add scripts directory to path
+sys.path.insert(0, str(Path(__file__).parent))
+
+from data_model import Board, Combo, ComboConfiguration, Layer, KeyGrid, MagicKeyConfiguration, MagicKeyMapping
+from validator import ConfigValidator, ValidationError
+
+
+def make_layers(*names):
+    core = KeyGrid(rows=[["A"] * 5] * 6 + [["C"] * 3] * 2)
+    return {name: Layer(name=name, core=core) for name in names}
+
+
+def make_board(**kwargs):
+    return Board(
+        id=kwargs.pop("id", "testboard"),
+        name="Test Board",
+        firmware="qmk",
+        qmk_keyboard="test/board",
+        **kwargs,
+    )
+
+
+def make_combo(name, layers=None):
+    return Combo(
+        name=name,
+        description="test",
+        key_positions=[0, 1],
+        action="ESC",
+        layers=layers,
+    )
+
+
+def test_valid_references_pass():
+    layers = make_layers("BASE_NIGHT", "NAV_NIGHT")
+    combos = ComboConfiguration(combos=[make_combo("c1", ["BASE_NIGHT"]), make_combo("c2", None)])
+    magic = MagicKeyConfiguration(mappings={
+        "BASE_NIGHT": MagicKeyMapping(base_layer="BASE_NIGHT", timeout_ms=0, mappings={"a": "b"}),
+    })
+    boards = [make_board(base_layers=["BASE_NIGHT"])]
+    ConfigValidator().validate_cross_references(layers, boards, combos=combos, magic_config=magic)
+
+
+def test_combo_unknown_layer_rejected():
+    layers = make_layers("BASE_NIGHT")
+    combos = ComboConfiguration(combos=[make_combo("c1", ["BASE_MISSING"])])
+    with pytest.raises(ValidationError, match="unknown layer 'BASE_MISSING'"):
+        ConfigValidator().validate_cross_references(layers, [make_board()], combos=combos)
+
+
+def test_duplicate_combo_name_rejected():
+    layers = make_layers("BASE_NIGHT")
+    combos = ComboConfiguration(combos=[make_combo("dup"), make_combo("dup")])
+    with pytest.raises(ValidationError, match="Duplicate combo name"):
+        ConfigValidator().validate_cross_references(layers, [make_board()], combos=combos)
+
+
+def test_magic_non_base_layer_rejected():
+    layers = make_layers("BASE_NIGHT", "NAV_NIGHT")
+    magic = MagicKeyConfiguration(mappings={
+        "NAV_NIGHT": MagicKeyMapping(base_layer="NAV_NIGHT", timeout_ms=0, mappings={"a": "b"}),
+    })
+    with pytest.raises(ValidationError, match="not a BASE layer"):
+        ConfigValidator().validate_cross_references(layers, [make_board()], magic_config=magic)
+
+
+def test_board_base_layers_unknown_rejected():
+    layers = make_layers("BASE_NIGHT")
+    boards = [make_board(base_layers=["BASE_GHOST"])]
+    with pytest.raises(ValidationError, match="base_layers references unknown layer"):
+        ConfigValidator().validate_cross_references(layers, boards)
+
+
+def test_extra_layers_may_be_enum_only():
+    # GAME on lulu/lily58 has no keymap.yaml definition; the generator emits
+    # it as an enum slot, so it must not be treated as a dangling reference
+    layers = make_layers("BASE_NIGHT")
+    boards = [make_board(extra_layers=["GAME"])]
+    ConfigValidator().validate_cross_references(layers, boards)
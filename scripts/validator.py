@@ -30,23 +30,22 @@ class ConfigValidator:
         if not layers:
             raise ValidationError("At least one layer must be defined")
 
-        # At least one BASE layer is required (BASE, BASE_COLEMAK, BASE_GALLIUM, etc.)
-        base_layers = [name for name in layers if name.startswith("BASE")]
-        if not base_layers:
-            raise ValidationError("At least one BASE layer is required (e.g., BASE, BASE_COLEMAK, BASE_GALLIUM)")
-
-        # Validate layer names are valid C identifiers
-        for layer_name in layers:
+        # Single structural pass: name check and layer check together, raising
+        # on the first problem instead of walking the whole config repeatedly
+        has_base = False
+        for layer_name, layer in layers.items():
             if not self._is_valid_c_identifier(layer_name):
                 raise ValidationError(
                     f"Invalid layer name: '{layer_name}'. "
                     f"Layer names must be uppercase alphanumeric with underscores"
                 )
-
-        # Validate each layer
-        for layer_name, layer in layers.items():
+            has_base = has_base or layer_name.startswith("BASE")
             self._validate_layer(layer_name, layer)
 
+        # At least one BASE layer is required (BASE, BASE_COLEMAK, BASE_GALLIUM, etc.)
+        if not has_base:
+            raise ValidationError("At least one BASE layer is required (e.g., BASE, BASE_COLEMAK, BASE_GALLIUM)")
+
     def validate_board_config(self, boards: List[Board]) -> None:
         """
         Validate board configuration
@@ -60,16 +59,67 @@ class ConfigValidator:
         if not boards:
             raise ValidationError("At least one board must be defined")
 
-        # Check for duplicate board IDs
-        board_ids = [board.id for board in boards]
-        duplicates = set([bid for bid in board_ids if board_ids.count(bid) > 1])
-        if duplicates:
-            raise ValidationError(f"Duplicate board IDs found: {duplicates}")
-
-        # Validate each board
+        # Duplicate detection with a seen-set (the old count()-per-id scan was
+        # quadratic in the number of boards)
+        seen_ids = set()
         for board in boards:
+            if board.id in seen_ids:
+                raise ValidationError(f"Duplicate board ID found: {board.id}")
+            seen_ids.add(board.id)
             self._validate_board(board)
 
+    def validate_cross_references(self, layers: Dict[str, Layer], boards: List[Board],
+                                  combos=None, magic_config=None) -> None:
+        """
+        Validate references between config files against pre-built indices
+
+        One set of layer names is built up front; every combo layer list,
+        magic key base layer, and boards.yaml layer reference is then a set
+        lookup instead of a scan over keymap.yaml. Raises on the first
+        dangling reference.
+
+        Args:
+            layers: Dictionary of layer name to Layer object
+            boards: List of Board objects
+            combos: Optional ComboConfiguration
+            magic_config: Optional MagicKeyConfiguration
+
+        Raises:
+            ValidationError: If a reference points at a missing layer
+        """
+        layer_index = set(layers)
+        base_index = {name for name in layer_index if name.startswith("BASE")}
+
+        if combos is not None:
+            seen_names = set()
+            for combo in combos.combos:
+                if combo.name in seen_names:
+                    raise ValidationError(f"Duplicate combo name: {combo.name}")
+                seen_names.add(combo.name)
+                for layer_name in combo.layers or ():
+                    if layer_name not in layer_index:
+                        raise ValidationError(
+                            f"Combo {combo.name}: references unknown layer '{layer_name}'"
+                        )
+
+        if magic_config is not None:
+            for base_layer in magic_config.mappings:
+                if base_layer not in base_index:
+                    raise ValidationError(
+                        f"Magic keys: '{base_layer}' is not a BASE layer in keymap.yaml"
+                    )
+
+        # Note: extra_layers is deliberately not checked against layer_index —
+        # the generator emits those names as enum slots even when keymap.yaml
+        # carries no definition (e.g. GAME on lulu/lily58), so an undefined
+        # extra layer is a valid reserved slot, not a dangling reference.
+        for board in boards:
+            for layer_name in board.base_layers or ():
+                if layer_name not in base_index:
+                    raise ValidationError(
+                        f"Board {board.id}: base_layers references unknown layer '{layer_name}'"
+                    )
+
     def _validate_layer(self, layer_name: str, layer: Layer) -> None:
         """
         Validate a single layer
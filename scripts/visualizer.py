@@ -2,6 +2,7 @@
 Keymap visualization generation using keymap-drawer
 """
 
+import hashlib
 import json
 import os
 import re
@@ -992,8 +993,46 @@ class KeymapVisualizer:
             layer_families[base_name] = self.base_layer_manager.get_layer_family(base_name)
         return layer_families
 
-    def generate_superset_visualizations(self, board_inventory) -> None:
-        """Generate visualizations grouped by base layer (3x6_3 only)"""
+    def _viz_digest(self, base_name: str, layer_names: List[str]) -> str:
+        """
+        Content hash of everything a base layer's diagrams depend on: the raw
+        YAML of its layer family and magic mappings, the display configs, and
+        this module (so a renderer change re-renders everything)
+        """
+        hasher = hashlib.sha256()
+        with open(self.config_dir / "keymap.yaml") as f:
+            keymap_data = yaml.safe_load(f)
+        for name in layer_names:
+            hasher.update(name.encode())
+            layer_data = keymap_data.get('layers', {}).get(name)
+            hasher.update(json.dumps(layer_data, sort_keys=True).encode())
+        magic_data = keymap_data.get('magic_keys', {}).get(base_name)
+        hasher.update(json.dumps(magic_data, sort_keys=True).encode())
+        for path in (self.config_dir / "keycodes.yaml",
+                     self.config_dir / "aliases.yaml",
+                     self.config_file,
+                     Path(__file__)):
+            if path.exists():
+                hasher.update(path.read_bytes())
+        return hasher.hexdigest()
+
+    def _viz_outputs(self, base_name: str) -> List[Path]:
+        """The files _generate_for_base_layer leaves behind for one base layer"""
+        output_name = base_name.replace('BASE_', '').lower()
+        return [
+            self.docs_dir / f"{output_name}.svg",
+            self.output_dir / f"{output_name}.pdf",
+            self.output_dir / f"{output_name}_base.pdf",
+        ]
+
+    def generate_superset_visualizations(self, board_inventory, cache=None, jobs: int = None) -> None:
+        """Generate visualizations grouped by base layer (3x6_3 only)
+
+        With a GenerationCache, base layers whose inputs are unchanged (and
+        whose outputs still exist) are skipped; the stale remainder renders in
+        a process pool, so the common one-layer-tweaked case redraws one
+        diagram instead of all of them.
+        """
         if not self.is_available():
             print("  ⚠️  keymap-drawer not available, skipping visualization")
             return
@@ -1003,11 +1042,37 @@ class KeymapVisualizer:
         layer_sets = self._get_layer_sets_by_base()
         layout_size = "3x6_3"
 
+        stale = []
         for base_name, layer_names in layer_sets.items():
-            print(f"  📊 Generating visualization for {base_name}")
-            self._generate_for_base_layer(base_name, layer_names, layout_size)
+            digest = self._viz_digest(base_name, layer_names) if cache else None
+            if cache and cache.viz_is_fresh(base_name, digest, self._viz_outputs(base_name)):
+                print(f"  ⏭️  {base_name} visualization is up to date")
+                continue
+            stale.append((base_name, layer_names, digest))
 
-        print(f"✅ Generated {len(layer_sets)} base layer visualizations")
+        if not stale:
+            print("✅ All base layer visualizations up to date")
+            return
+
+        if len(stale) > 1:
+            from multiprocessing import Pool, cpu_count
+            workers = jobs or min(len(stale), cpu_count())
+            print(f"  📊 Rendering {len(stale)} base layers with {workers} workers")
+            work = [(str(self.repo_root), base_name, layer_names, layout_size)
+                    for base_name, layer_names, _ in stale]
+            with Pool(workers) as pool:
+                pool.map(_render_base_layer_worker, work)
+        else:
+            for base_name, layer_names, _ in stale:
+                print(f"  📊 Generating visualization for {base_name}")
+                self._generate_for_base_layer(base_name, layer_names, layout_size)
+
+        if cache:
+            for base_name, _, digest in stale:
+                cache.viz_update(base_name, digest)
+
+        print(f"✅ Generated {len(stale)} base layer visualizations "
+              f"({len(layer_sets) - len(stale)} cached)")
 
     def _generate_for_base_layer(self, base_name: str, layer_names: List[str],
                                   layout_size: str) -> None:
@@ -2504,3 +2569,13 @@ class KeymapVisualizer:
             # Space row (8 keys) - all empty (will be grey)
             [""] * 8
         )
+
+
+def _render_base_layer_worker(args):
+    """Process-pool entry point: build a fresh visualizer in the child and
+    render one base layer's diagram set (keymap-drawer subprocess + PDFs)"""
+    repo_root, base_name, layer_names, layout_size = args
+    print(f"  📊 Generating visualization for {base_name}")
+    visualizer = KeymapVisualizer(Path(repo_root))
+    visualizer._generate_for_base_layer(base_name, layer_names, layout_size)
+    return base_name
@@ -316,14 +316,21 @@ class ZMKGenerator:
         Returns:
             Translated positions for the board's physical ZMK layout
         """
+        return self.translate_positions(canonical_positions, board.layout_size)
+
+    def translate_positions(self, canonical_positions: List[int], layout_size: str) -> List[int]:
+        """
+        Translate canonical row-wise 36-key positions to a physical ZMK layout.
+        Shared by combo key-positions and the hold-trigger position tables.
+        """
         # For 3x5_3 boards, direct 1:1 mapping (row-wise in = row-wise out)
-        if board.layout_size == "3x5_3":
+        if layout_size == "3x5_3":
             return canonical_positions
 
         # For 3x6_3 boards: map row-wise 36-key → row-wise 42-key with pinky columns
         # Output: rows of 12 keys (0-11, 12-23, 24-35) + 6 thumbs (36-41)
         # Each row: [pinky, left0-4, right0-4, pinky]
-        if board.layout_size == "3x6_3":
+        if layout_size == "3x6_3":
             translated = []
             for pos in canonical_positions:
                 if pos < 30:  # Alpha keys (rows 0-2)
@@ -339,6 +346,43 @@ class ZMKGenerator:
         # For other layouts, return as-is
         return canonical_positions
 
+    def hand_positions(self, hand: str, layout_size: str = "3x6_3") -> List[int]:
+        """
+        Physical alpha-block positions for one hand, derived from the canonical
+        scheme (columns 0-4 of each row are left hand, 5-9 right). For 3x6_3
+        the outer pinky column — which has no canonical position — is added on
+        the matching side.
+        """
+        cols = range(0, 5) if hand == "left" else range(5, 10)
+        canonical = [row * 10 + col for row in range(3) for col in cols]
+        positions = self.translate_positions(canonical, layout_size)
+        if layout_size == "3x6_3":
+            pinky_col = 0 if hand == "left" else 11
+            positions = positions + [row * 12 + pinky_col for row in range(3)]
+        return sorted(positions)
+
+    def thumb_positions(self, hand: str, layout_size: str = "3x6_3") -> List[int]:
+        """Physical thumb positions for one hand (canonical 30-32 / 33-35)"""
+        canonical = [30, 31, 32] if hand == "left" else [33, 34, 35]
+        return sorted(self.translate_positions(canonical, layout_size))
+
+    def generate_position_defines(self, layout_size: str = "3x6_3") -> List[str]:
+        """
+        #define lines for the per-hand position tables, consumed by the
+        hold-trigger-key-positions lists in dario_behaviors.dtsi and in the
+        generated training hold-taps. A home row mod triggers its hold only
+        on opposite-hand positions (POS_RIGHT_HAND POS_RIGHT_THUMBS for hml,
+        mirrored for hmr) — the same fast-settle chordal tuning QMK derives
+        from chordal_hold_layout.
+        """
+        fmt = lambda positions: " ".join(str(p) for p in positions)
+        return [
+            f"#define POS_LEFT_HAND    {fmt(self.hand_positions('left', layout_size))}",
+            f"#define POS_RIGHT_HAND   {fmt(self.hand_positions('right', layout_size))}",
+            f"#define POS_LEFT_THUMBS  {fmt(self.thumb_positions('left', layout_size))}",
+            f"#define POS_RIGHT_THUMBS {fmt(self.thumb_positions('right', layout_size))}",
+        ]
+
     def generate_combos_section(self, combos: ComboConfiguration, layer_names: List[str], board: Board) -> str:
         """
         Generate ZMK combos devicetree section
@@ -827,7 +871,7 @@ class ZMKGenerator:
                         code_lines.append(f"            tapping-term-ms = <280>;")
                         code_lines.append(f"            quick-tap-ms = <175>;")
                         code_lines.append(f"            bindings = <&kp>, <{ak_train_ref}>;")
-                        code_lines.append(f"            hold-trigger-key-positions = <6 7 8 9 10 11 18 19 20 21 22 23 30 31 32 33 34 35 39 40 41>;  // right hand + thumbs")
+                        code_lines.append(f"            hold-trigger-key-positions = <POS_RIGHT_HAND POS_RIGHT_THUMBS>;  // generated tables in dario_behaviors.dtsi")
                         code_lines.append(f"            hold-trigger-on-release;")
                         code_lines.append(f"        }};")
                         code_lines.append("")
@@ -848,7 +892,7 @@ class ZMKGenerator:
                         code_lines.append(f"            tapping-term-ms = <280>;")
                         code_lines.append(f"            quick-tap-ms = <175>;")
                         code_lines.append(f"            bindings = <&kp>, <{ak_train_ref}>;")
-                        code_lines.append(f"            hold-trigger-key-positions = <0 1 2 3 4 5 12 13 14 15 16 17 24 25 26 27 28 29 36 37 38>;  // left hand + thumbs")
+                        code_lines.append(f"            hold-trigger-key-positions = <POS_LEFT_HAND POS_LEFT_THUMBS>;  // generated tables in dario_behaviors.dtsi")
                         code_lines.append(f"            hold-trigger-on-release;")
                         code_lines.append(f"        }};")
                         code_lines.append("")